@@ -113,13 +113,28 @@ def extractenvironments(output_json_path, project, asset, task, app, envgroup):
               multiple=True)
 @click.option("-g", "--gui", is_flag=True,
               help="Show Publish UI", default=False)
-def publish(path, targets, gui):
+@click.option("-w", "--use-worker", is_flag=True, default=False,
+              help="Publish in running publish worker if available")
+def publish(path, targets, gui, use_worker):
     """Start CLI publishing.
 
     Publish collects json from path provided as an argument.
 S
     """
-    Commands.publish(path, targets, gui)
+    Commands.publish(path, targets, gui, use_worker)
+
+
+@main_cli.command()
+@click.option("-p", "--port", type=int, default=None,
+              help="Port where worker listens")
+def publish_worker(port):
+    """Start publish worker processing farm publish jobs.
+
+    Worker keeps addons and discovered plugins initialized and processes
+    jobs sent by 'publish --use-worker' one by one. Farm jobs can enable
+    it with 'AYON_PUBLISH_USE_WORKER=1' in job environment.
+    """
+    Commands.publish_worker(port)
 
 
 @main_cli.command(context_settings={"ignore_unknown_options": True})
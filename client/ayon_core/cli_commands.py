@@ -41,7 +41,12 @@ class Commands:
         return click_func
 
     @staticmethod
-    def publish(path: str, targets: list=None, gui:bool=False) -> None:
+    def publish(
+        path: str,
+        targets: list=None,
+        gui:bool=False,
+        use_worker:bool=False
+    ) -> None:
         """Start headless publishing.
 
         Publish use json from passed path argument.
@@ -50,6 +55,10 @@ class Commands:
             path (str): Path to JSON.
             targets (list of str): List of pyblish targets.
             gui (bool): Show publish UI.
+            use_worker (bool): Process publish in running publish worker.
+                Publish is processed in current process if worker is not
+                running. Can be enabled with 'AYON_PUBLISH_USE_WORKER'
+                environment variable.
 
         Raises:
             RuntimeError: When there is no path to process.
@@ -63,6 +72,12 @@ class Commands:
             install_ayon_plugins,
             get_global_context,
         )
+        from ayon_core.pipeline.publish.publish_worker import (
+            fix_legacy_env_keys,
+            is_worker_enabled,
+            submit_publish_job,
+            print_publish_job_result,
+        )
 
         import ayon_api
         import pyblish.util
@@ -72,21 +87,31 @@ class Commands:
             raise RuntimeError("Path to JSON must be a string.")
 
         # Fix older jobs
-        for src_key, dst_key in (
-            ("AVALON_PROJECT", "AYON_PROJECT_NAME"),
-            ("AVALON_ASSET", "AYON_FOLDER_PATH"),
-            ("AVALON_TASK", "AYON_TASK_NAME"),
-            ("AVALON_WORKDIR", "AYON_WORKDIR"),
-            ("AVALON_APP_NAME", "AYON_APP_NAME"),
-            ("AVALON_APP", "AYON_HOST_NAME"),
-        ):
-            if src_key in os.environ and dst_key not in os.environ:
-                os.environ[dst_key] = os.environ[src_key]
-            # Remove old keys, so we're sure they're not used
-            os.environ.pop(src_key, None)
+        fix_legacy_env_keys(os.environ)
 
         log = Logger.get_logger("CLI-publish")
 
+        if (use_worker or is_worker_enabled()) and not gui:
+            try:
+                result = submit_publish_job(path, targets)
+            except OSError:
+                log.info(
+                    "Publish worker is not running. Publishing in current"
+                    " process."
+                )
+            else:
+                if result.get("rejected"):
+                    log.info(
+                        "Publish worker rejected the job: {}. Publishing in"
+                        " current process.".format(result["error"])
+                    )
+                else:
+                    print_publish_job_result(result)
+                    if not result["success"]:
+                        sys.exit(1)
+                    log.info("Publish finished.")
+                    return
+
         # Make public ayon api behave as other user
         # - this works only if public ayon api is using service user
         username = os.environ.get("AYON_USERNAME")
@@ -156,6 +181,25 @@ class Commands:
 
         log.info("Publish finished.")
 
+    @staticmethod
+    def publish_worker(port: int=None) -> None:
+        """Start publish worker processing publish jobs in warm process.
+
+        Args:
+            port (int): Port where worker listens.
+
+        """
+        from ayon_core.lib import Logger
+        from ayon_core.pipeline.publish.publish_worker import PublishWorker
+
+        Logger.set_process_name("PublishWorker")
+
+        worker = PublishWorker(port)
+        try:
+            worker.serve_forever()
+        except KeyboardInterrupt:
+            pass
+
     @staticmethod
     def extractenvironments(
         output_json_path, project, asset, task, app, env_group
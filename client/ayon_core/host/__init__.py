@@ -9,7 +9,7 @@ from .interfaces import (
     INewPublisher,
 )
 
-from .dirmap import HostDirmap
+from .dirmap import PathRemapTable, HostDirmap
 
 
 __all__ = (
@@ -20,5 +20,6 @@ __all__ = (
     "IPublishHost",
     "INewPublisher",
 
+    "PathRemapTable",
     "HostDirmap",
 )
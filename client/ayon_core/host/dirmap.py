@@ -7,6 +7,7 @@ exists is used.
 """
 
 import os
+import re
 from abc import ABCMeta, abstractmethod
 import platform
 
@@ -18,6 +19,138 @@ from ayon_core.settings import get_project_settings
 from ayon_core.settings.lib import get_site_local_overrides
 
 
+_SEPARATORS_REGEX = re.compile(r"[\\/]+")
+
+
+def _split_path(path):
+    """Split path to components with end offset of each component.
+
+    Leading separators are kept as first component to distinguish
+    absolute and UNC paths.
+
+    Returns:
+        list[tuple[str, int]]: Components with end offsets in path.
+    """
+    output = []
+    root_match = _SEPARATORS_REGEX.match(path)
+    start = 0
+    if root_match is not None:
+        start = root_match.end()
+        output.append(("/" * min(start, 2), start))
+
+    for match in _SEPARATORS_REGEX.finditer(path, start):
+        if match.start() > start:
+            output.append((path[start:match.start()], match.start()))
+        start = match.end()
+
+    if start < len(path):
+        output.append((path[start:], len(path)))
+    return output
+
+
+class PathRemapTable(object):
+    """Compiled mapping of source roots to destination roots.
+
+    Source roots are stored in prefix tree by path components, so each path
+    is remapped by walking its components once, independently of number of
+    mapped roots. Longest matching source root is used, first one wins if
+    the same root is mapped multiple times. Results are cached by path.
+
+    Args:
+        mapping (dict[str, list[str]]): Mapping with 'source_path' and
+            'destination_path' lists as returned by
+            'HostDirmap.get_mappings'.
+        case_sensitive (Optional[bool]): Compare path components case
+            sensitive. Case insensitive on Windows by default.
+    """
+
+    def __init__(self, mapping, case_sensitive=None):
+        if case_sensitive is None:
+            case_sensitive = platform.system().lower() != "windows"
+        self._case_sensitive = case_sensitive
+        self._trie = {}
+        self._cache = {}
+
+        source_paths = mapping.get("source_path") or []
+        destination_paths = mapping.get("destination_path") or []
+        for source_path, destination_path in zip(
+            source_paths, destination_paths
+        ):
+            self._add(source_path, destination_path)
+
+    def __bool__(self):
+        return bool(self._trie)
+
+    def _normalize_component(self, component):
+        if self._case_sensitive:
+            return component
+        return component.lower()
+
+    def _add(self, source_path, destination_path):
+        components = _split_path(source_path)
+        if not components:
+            return
+
+        node = self._trie
+        for component, _ in components:
+            node = node.setdefault(
+                self._normalize_component(component), {}
+            )
+        # Empty string can't be path component, so it is used as key of
+        #   destination
+        node.setdefault("", destination_path)
+
+    def remap_path(self, path):
+        """Remap path using longest matching source root.
+
+        Args:
+            path (str): Path to remap.
+
+        Returns:
+            str: Remapped path or the same path if no source root matches.
+        """
+        result = self._cache.get(path)
+        if result is not None:
+            return result
+
+        result = path
+        node = self._trie
+        destination_path = end = None
+        for component, component_end in _split_path(path):
+            node = node.get(self._normalize_component(component))
+            if node is None:
+                break
+            if "" in node:
+                destination_path = node[""]
+                end = component_end
+
+        if destination_path is not None:
+            remainder = path[end:]
+            if remainder:
+                separator = "/"
+                if "\\" in destination_path and "/" not in destination_path:
+                    separator = "\\"
+                remainder = _SEPARATORS_REGEX.sub(
+                    lambda _: separator, remainder
+                )
+                destination_path = destination_path.rstrip("\\/")
+            result = destination_path + remainder
+
+        self._cache[path] = result
+        return result
+
+    def remap_paths(self, paths):
+        """Remap multiple paths.
+
+        Args:
+            paths (Iterable[str]): Paths to remap.
+
+        Returns:
+            list[str]: Remapped paths in the same order.
+        """
+        return [self.remap_path(path) for path in paths]
+
+
 @six.add_metaclass(ABCMeta)
 class HostDirmap(object):
     """Abstract class for running dirmap on a workfile in a host.
@@ -45,6 +178,7 @@ class HostDirmap(object):
         # to limit reinit of Modules
         self._sitesync_addon_discovered = sitesync_addon is not None
         self._log = None
+        self._remap_table = None
 
     @property
     def sitesync_addon(self):
@@ -87,6 +221,7 @@ class HostDirmap(object):
 
         if not mapping:
             mapping = self.get_mappings()
+        self._remap_table = PathRemapTable(mapping or {})
         if not mapping:
             return
 
@@ -115,6 +250,30 @@ class HostDirmap(object):
                 )
                 continue
 
+    def get_remap_table(self):
+        """Compiled remap table of mapping from settings.
+
+        Table is created on first call and reused, use it in hosts where
+        paths are remapped one by one (e.g. callback of file loading).
+
+        Returns:
+            PathRemapTable: Remap table, empty if dirmap is disabled.
+        """
+        if self._remap_table is None:
+            self._remap_table = PathRemapTable(self.get_mappings())
+        return self._remap_table
+
+    def remap_paths(self, paths):
+        """Remap multiple paths using mapping from settings.
+
+        Args:
+            paths (Iterable[str]): Paths to remap.
+
+        Returns:
+            list[str]: Remapped paths in the same order.
+        """
+        return self.get_remap_table().remap_paths(paths)
+
     def get_mappings(self):
         """Get translation from source_path to destination_path.
 
@@ -14,6 +14,10 @@ from .local_settings import (
     get_openpype_username,
 )
 from .ayon_connection import initialize_ayon_connection
+from .ayon_api_queries import (
+    AYONQueryExecutor,
+    get_ayon_query_executor,
+)
 from .cache import (
     CacheItem,
     NestedCacheItem,
@@ -67,6 +71,12 @@ from .execute import (
     path_to_subprocess_arg,
     CREATE_NO_WINDOW
 )
+from .process_scheduler import (
+    ProcessPriority,
+    ProcessJob,
+    ProcessScheduler,
+    get_process_scheduler,
+)
 from .log import (
     Logger,
 )
@@ -94,6 +104,9 @@ from .python_module_tools import (
 
 from .profiles_filtering import (
     compile_list_of_regexes,
+    ProfilesMatcher,
+    get_profiles_matcher,
+    clear_profiles_matchers_cache,
     filter_profiles
 )
 
@@ -119,6 +132,8 @@ from .plugin_tools import (
 from .path_tools import (
     format_file_size,
     collect_frames,
+    scan_directory,
+    DirectoryScanner,
     create_hard_link,
     version_up,
     get_version_from_path,
@@ -148,6 +163,8 @@ __all__ = [
     "get_openpype_username",
 
     "initialize_ayon_connection",
+    "AYONQueryExecutor",
+    "get_ayon_query_executor",
 
     "CacheItem",
     "NestedCacheItem",
@@ -166,6 +183,11 @@ __all__ = [
     "path_to_subprocess_arg",
     "CREATE_NO_WINDOW",
 
+    "ProcessPriority",
+    "ProcessJob",
+    "ProcessScheduler",
+    "get_process_scheduler",
+
     "env_value_to_bool",
     "get_paths_from_environ",
 
@@ -211,6 +233,9 @@ __all__ = [
     "get_rescaled_command_arguments",
 
     "compile_list_of_regexes",
+    "ProfilesMatcher",
+    "get_profiles_matcher",
+    "clear_profiles_matchers_cache",
 
     "filter_profiles",
 
@@ -219,6 +244,8 @@ __all__ = [
 
     "format_file_size",
     "collect_frames",
+    "scan_directory",
+    "DirectoryScanner",
     "create_hard_link",
     "version_up",
     "get_version_from_path",
@@ -4,6 +4,9 @@ import collections
 import uuid
 import json
 import copy
+import hashlib
+import weakref
+import threading
 from abc import ABCMeta, abstractmethod, abstractproperty
 
 import six
@@ -12,6 +15,9 @@ import clique
 # Global variable which store attribute definitions by type
 #   - default types are registered on import
 _attr_defs_by_type = {}
+# Interned (read-only) attribute definitions by content hash
+_interned_attr_defs = weakref.WeakValueDictionary()
+_interned_attr_defs_lock = threading.Lock()
 
 
 def register_attr_def_class(cls):
@@ -75,12 +81,90 @@ def get_default_values(attribute_definitions):
     return output
 
 
+def _json_default(value):
+    if isinstance(value, (set, frozenset)):
+        return sorted(value, key=str)
+    return str(value)
+
+
+def _get_data_hash(data):
+    """Stable hash of serialized attribute definition data.
+
+    Args:
+        data (Dict[str, Any]): Serialized attribute definition.
+
+    Returns:
+        str: Hash of data.
+    """
+
+    json_data = json.dumps(data, sort_keys=True, default=_json_default)
+    return hashlib.sha256(json_data.encode("utf-8")).hexdigest()
+
+
+class _ReadOnlyDict(dict):
+    """Dictionary used in values of read-only attribute definitions.
+
+    Copies of the dictionary are regular dictionaries.
+    """
+
+    def _read_only(self, *args, **kwargs):
+        raise TypeError("Value of read-only attribute definition")
+
+    __setitem__ = _read_only
+    __delitem__ = _read_only
+    __ior__ = _read_only
+    clear = _read_only
+    pop = _read_only
+    popitem = _read_only
+    setdefault = _read_only
+    update = _read_only
+
+    def __copy__(self):
+        return dict(self)
+
+    def __deepcopy__(self, memo):
+        return {
+            key: copy.deepcopy(value, memo)
+            for key, value in self.items()
+        }
+
+    def __reduce__(self):
+        return dict, (dict(self), )
+
+
+def _freeze_value(value):
+    """Convert value to its read-only variant.
+
+    Dictionaries are converted to '_ReadOnlyDict', lists and tuples to
+        tuples and sets to frozensets.
+    """
+
+    if isinstance(value, dict):
+        return _ReadOnlyDict(
+            (key, _freeze_value(item))
+            for key, item in value.items()
+        )
+    if isinstance(value, (list, tuple)):
+        return tuple(_freeze_value(item) for item in value)
+    if isinstance(value, set):
+        return frozenset(value)
+    return value
+
+
 class AbstractAttrDefMeta(ABCMeta):
     """Metaclass to validate existence of 'key' attribute.
 
     Each object of `AbstractAttrDef` mus have defined 'key' attribute.
     """
 
+    def __new__(mcs, name, bases, attrs):
+        # Python 3 sets '__hash__' to None when only '__eq__' is overridden
+        if "__eq__" in attrs and "__hash__" not in attrs and bases:
+            attrs["__hash__"] = bases[0].__hash__
+        return super(AbstractAttrDefMeta, mcs).__new__(
+            mcs, name, bases, attrs
+        )
+
     def __call__(self, *args, **kwargs):
         obj = super(AbstractAttrDefMeta, self).__call__(*args, **kwargs)
         init_class = getattr(obj, "__init__class__", None)
@@ -120,6 +204,10 @@ class AbstractAttrDef(object):
 
     is_value_def = True
 
+    _frozen = False
+    _cached_serialized_data = None
+    _cached_content_hash = None
+
     def __init__(
         self,
         key,
@@ -151,6 +239,46 @@ class AbstractAttrDef(object):
     def id(self):
         return self._id
 
+    @property
+    def is_frozen(self):
+        """Definition is read-only.
+
+        Returns:
+            bool: Definition can't be modified.
+        """
+
+        return self._frozen
+
+    def freeze(self):
+        """Make definition read-only.
+
+        Public attributes can't be set and their values are converted to
+            read-only types (e.g. lists to tuples). Serialized data and
+            content hash of read-only definition are cached.
+
+        Default value keeps its type, so it is still a valid value. It must
+            not be modified, consumers should use a copy.
+        """
+
+        if self._frozen:
+            return
+        for key, value in tuple(vars(self).items()):
+            if not key.startswith("_") and key != "default":
+                object.__setattr__(self, key, _freeze_value(value))
+        object.__setattr__(self, "_frozen", True)
+
+    def __setattr__(self, key, value):
+        if self._frozen and not key.startswith("_"):
+            raise AttributeError(
+                "Attribute definition '{}' is read-only".format(self.key)
+            )
+        object.__setattr__(self, key, value)
+
+    def __hash__(self):
+        # Must be consistent with '__eq__' which compares only some of
+        #   attributes, use 'content_hash' to compare whole definition
+        return hash((self.type, self.key))
+
     def __eq__(self, other):
         if not isinstance(other, self.__class__):
             return False
@@ -215,6 +343,44 @@ class AbstractAttrDef(object):
 
         return cls(**data)
 
+    def get_serialized_data(self):
+        """Output of 'serialize', cached for read-only definition.
+
+        Cached output is shared and read-only, use 'copy.deepcopy' to get
+            modifiable data.
+
+        Returns:
+            Dict[str, Any]: Serialized object.
+        """
+
+        if not self._frozen:
+            return self.serialize()
+
+        if self._cached_serialized_data is None:
+            self._cached_serialized_data = _freeze_value(self.serialize())
+        return self._cached_serialized_data
+
+    @property
+    def content_hash(self):
+        """Stable hash of serialized definition.
+
+        Definitions with same content hash are interchangeable, unlike
+            '__eq__' it does compare all attributes including label. Hash
+            is cached only for read-only definition.
+
+        Returns:
+            str: Hash of attribute definition.
+        """
+
+        if not self._frozen:
+            return _get_data_hash(self.serialize())
+
+        if self._cached_content_hash is None:
+            self._cached_content_hash = _get_data_hash(
+                self.get_serialized_data()
+            )
+        return self._cached_content_hash
+
 
 # -----------------------------------------
 # UI attribute definitoins won't hold value
@@ -424,7 +590,10 @@ class TextDef(AbstractAttrDef):
 
     def serialize(self):
         data = super(TextDef, self).serialize()
-        data["regex"] = self.regex.pattern
+        regex = self.regex
+        if regex is not None:
+            regex = regex.pattern
+        data["regex"] = regex
         return data
 
 
@@ -487,7 +656,7 @@ class EnumDef(AbstractAttrDef):
             return self.default
 
         if value is None:
-            return copy.deepcopy(self.default)
+            return list(self.default)
         return list(self._item_values.intersection(value))
 
     def serialize(self):
@@ -532,6 +701,7 @@ class EnumDef(AbstractAttrDef):
                     if "value" not in item:
                         raise KeyError("Item does not contain 'value' key.")
 
+                    item = dict(item)
                     if "label" not in item:
                         item["label"] = str(item["value"])
                 elif isinstance(item, (list, tuple)):
@@ -910,7 +1080,7 @@ class FileDef(AbstractAttrDef):
                 return dict_items
 
             if not dict_items:
-                return self.default
+                return copy.deepcopy(self.default)
             return dict_items[0]
 
         if self.single_item:
@@ -921,6 +1091,9 @@ class FileDef(AbstractAttrDef):
 def serialize_attr_def(attr_def):
     """Serialize attribute definition to data.
 
+    Output of read-only definition is cached and shared, it must not be
+        modified.
+
     Args:
         attr_def (AbstractAttrDef): Attribute definition to serialize.
 
@@ -928,12 +1101,15 @@ def serialize_attr_def(attr_def):
         Dict[str, Any]: Serialized data.
     """
 
-    return attr_def.serialize()
+    return attr_def.get_serialized_data()
 
 
 def serialize_attr_defs(attr_defs):
     """Serialize attribute definitions to data.
 
+    Output of read-only definitions is cached and shared, it must not be
+        modified.
+
     Args:
         attr_defs (List[AbstractAttrDef]): Attribute definitions to serialize.
 
@@ -947,27 +1123,78 @@ def serialize_attr_defs(attr_defs):
     ]
 
 
-def deserialize_attr_def(attr_def_data):
+def intern_attr_def(attr_def):
+    """Get shared read-only attribute definition with same content.
+
+    Identical attribute definitions of many instances can share one object
+        so serialization and hashing happen only once. Read-only copy of
+        passed definition is stored if definition is not read-only yet, so
+        definitions owned by plugins are not affected.
+
+    Args:
+        attr_def (AbstractAttrDef): Attribute definition.
+
+    Returns:
+        AbstractAttrDef: Interned attribute definition with same content.
+    """
+
+    content_hash = attr_def.content_hash
+    with _interned_attr_defs_lock:
+        interned = _interned_attr_defs.get(content_hash)
+    if interned is not None:
+        return interned
+
+    if not attr_def.is_frozen:
+        attr_def = copy.deepcopy(attr_def)
+        attr_def.freeze()
+
+    with _interned_attr_defs_lock:
+        interned = _interned_attr_defs.get(content_hash)
+        if interned is None:
+            _interned_attr_defs[content_hash] = attr_def
+            interned = attr_def
+    return interned
+
+
+def deserialize_attr_def(attr_def_data, intern=False):
     """Deserialize attribute definition from data.
 
     Args:
-        attr_def (Dict[str, Any]): Attribute definition data to deserialize.
+        attr_def_data (Dict[str, Any]): Attribute definition data to
+            deserialize.
+        intern (Optional[bool]): Return shared read-only definition, see
+            'intern_attr_def'.
+
+    Returns:
+        AbstractAttrDef: Attribute definition.
     """
 
+    attr_def_data = dict(attr_def_data)
     attr_type = attr_def_data.pop("type")
     cls = _attr_defs_by_type[attr_type]
-    return cls.deserialize(attr_def_data)
+    attr_def = cls.deserialize(attr_def_data)
+    if intern:
+        # New object does not have to be copied
+        attr_def.freeze()
+        attr_def = intern_attr_def(attr_def)
+    return attr_def
 
 
-def deserialize_attr_defs(attr_defs_data):
+def deserialize_attr_defs(attr_defs_data, intern=False):
     """Deserialize attribute definitions.
 
     Args:
-        List[Dict[str, Any]]: List of attribute definitions.
+        attr_defs_data (List[Dict[str, Any]]): List of attribute
+            definitions.
+        intern (Optional[bool]): Return shared read-only definitions, see
+            'intern_attr_def'.
+
+    Returns:
+        List[AbstractAttrDef]: Attribute definitions.
     """
 
     return [
-        deserialize_attr_def(attr_def_data)
+        deserialize_attr_def(attr_def_data, intern)
         for attr_def_data in attr_defs_data
     ]
 
@@ -0,0 +1,166 @@
+"""Concurrent queries of ayon_api functions.
+
+Tools and plugins often call independent 'ayon_api' queries one after
+another. The executor runs them on a pool of threads sharing the global
+server connection, so they can be started at once and awaited later.
+Identical queries running at the same time are coalesced into one request.
+
+Example:
+    >>> executor = get_ayon_query_executor()
+    >>> project_future = executor.query("get_project", project_name)
+    >>> repres_future = executor.query(
+    ...     "get_representations", project_name, version_ids=version_ids
+    ... )
+    >>> project_entity = project_future.result()
+    >>> repre_entities = repres_future.result()
+
+Results of generator functions (e.g. 'get_versions') are converted to
+lists. Results can be shared by coalesced callers and must not be
+modified.
+"""
+
+import asyncio
+import threading
+from concurrent.futures import ThreadPoolExecutor
+
+import ayon_api
+
+
+def _freeze_value(value):
+    """Convert value to hashable object usable as query key.
+
+    Raises:
+        TypeError: When value can't be converted to hashable object.
+
+    """
+    if isinstance(value, (set, frozenset)):
+        return frozenset(_freeze_value(item) for item in value)
+    if isinstance(value, (list, tuple)):
+        return tuple(_freeze_value(item) for item in value)
+    if isinstance(value, dict):
+        return frozenset(
+            (key, _freeze_value(item))
+            for key, item in value.items()
+        )
+    hash(value)
+    return value
+
+
+class AYONQueryExecutor:
+    """Run ayon_api queries concurrently.
+
+    Args:
+        max_workers (Optional[int]): Maximum number of queries running at
+            the same time.
+        api (Optional[Any]): Object with query functions. 'ayon_api' module
+            is used by default, a connection object or mock object can be
+            used too.
+
+    """
+    def __init__(self, max_workers=8, api=None):
+        if api is None:
+            api = ayon_api
+        self._api = api
+        self._executor = ThreadPoolExecutor(
+            max_workers=max_workers,
+            thread_name_prefix="AYONQuery"
+        )
+        self._futures_by_key = {}
+        # Done callback is called in the same thread if query is already
+        #   finished
+        self._lock = threading.RLock()
+
+    def query(self, func_name, *args, **kwargs):
+        """Start query of ayon_api function.
+
+        Args:
+            func_name (str): Name of function on api object, e.g.
+                'get_versions'.
+            *args: Positional arguments of the function.
+            **kwargs: Keyword arguments of the function.
+
+        Returns:
+            concurrent.futures.Future: Future with result of the query.
+
+        """
+        func = getattr(self._api, func_name)
+        try:
+            key = (func_name, _freeze_value(args), _freeze_value(kwargs))
+        except TypeError:
+            # Arguments are not hashable, query can't be coalesced
+            key = None
+
+        with self._lock:
+            if key is not None:
+                future = self._futures_by_key.get(key)
+                if future is not None:
+                    return future
+
+            future = self._executor.submit(self._run, func, args, kwargs)
+            if key is not None:
+                self._futures_by_key[key] = future
+                future.add_done_callback(
+                    lambda _: self._on_query_done(key)
+                )
+        return future
+
+    async def query_async(self, func_name, *args, **kwargs):
+        """Asyncio variant of 'query'.
+
+        Returns:
+            Any: Result of the query.
+
+        """
+        return await asyncio.wrap_future(
+            self.query(func_name, *args, **kwargs)
+        )
+
+    def query_many(self, queries):
+        """Start multiple queries at once and wait for all results.
+
+        Args:
+            queries (Iterable[tuple[str, tuple, dict]]): Function name,
+                positional and keyword arguments of each query.
+
+        Returns:
+            list[Any]: Results in order of queries.
+
+        """
+        futures = [
+            self.query(func_name, *args, **kwargs)
+            for func_name, args, kwargs in queries
+        ]
+        return [future.result() for future in futures]
+
+    def shutdown(self, wait=True):
+        self._executor.shutdown(wait=wait)
+
+    def _on_query_done(self, key):
+        with self._lock:
+            self._futures_by_key.pop(key, None)
+
+    @staticmethod
+    def _run(func, args, kwargs):
+        result = func(*args, **kwargs)
+        # Generators can't be consumed from multiple threads
+        if result is not None and hasattr(result, "__next__"):
+            result = list(result)
+        return result
+
+
+_executor = None
+_executor_lock = threading.Lock()
+
+
+def get_ayon_query_executor():
+    """Query executor shared in current process.
+
+    Returns:
+        AYONQueryExecutor: Shared query executor.
+
+    """
+    global _executor
+    with _executor_lock:
+        if _executor is None:
+            _executor = AYONQueryExecutor()
+    return _executor
@@ -2,6 +2,9 @@ import os
 import logging
 import sys
 import errno
+import threading
+from concurrent.futures import ThreadPoolExecutor
+
 import six
 
 from ayon_core.lib import create_hard_link
@@ -49,12 +52,23 @@ class FileTransaction(object):
 
     Warning:
         Any folders created during the transfer will not be removed.
+
+    Args:
+        log (Optional[logging.Logger]): Logger used for output.
+        allow_queue_replacements (Optional[bool]): Allow to replace
+            transfer to destination that is already in queue.
+        max_workers (Optional[int]): Number of threads used to transfer
+            files. Transfers are processed serially if is set to 1 or less.
+            Network storages benefit from multiple copies in flight.
+
     """
 
     MODE_COPY = 0
     MODE_HARDLINK = 1
 
-    def __init__(self, log=None, allow_queue_replacements=False):
+    def __init__(
+        self, log=None, allow_queue_replacements=False, max_workers=None
+    ):
         if log is None:
             log = logging.getLogger("FileTransaction")
 
@@ -72,6 +86,11 @@ class FileTransaction(object):
 
         self._allow_queue_replacements = allow_queue_replacements
 
+        if max_workers is None:
+            max_workers = 1
+        self._max_workers = max_workers
+        self._transferred_lock = threading.Lock()
+
     def add(self, src, dst, mode=MODE_COPY):
         """Add a new file to transfer queue.
 
@@ -126,6 +145,7 @@ class FileTransaction(object):
             os.rename(dst, backup)
 
         # Copy the files to transfer
+        transfers = []
         for dst, (src, opts) in self._transfers.items():
             path_same = self._same_paths(src, dst)
             if path_same:
@@ -133,17 +153,42 @@ class FileTransaction(object):
                     "Source and destination are same files {} -> {}".format(
                         src, dst))
                 continue
-
-            self._create_folder_for_file(dst)
-
-            if opts["mode"] == self.MODE_COPY:
-                self.log.debug("Copying file ... {} -> {}".format(src, dst))
-                copyfile(src, dst)
-            elif opts["mode"] == self.MODE_HARDLINK:
-                self.log.debug("Hardlinking file ... {} -> {}".format(
-                    src, dst))
-                create_hard_link(src, dst)
-
+            transfers.append((src, dst, opts))
+
+        # Create destination folders upfront so workers don't race on them
+        for dirpath in {os.path.dirname(dst) for _, dst, _ in transfers}:
+            self._create_folder(dirpath)
+
+        if self._max_workers <= 1 or len(transfers) < 2:
+            for src, dst, opts in transfers:
+                self._transfer_file(src, dst, opts)
+            return
+
+        max_workers = min(self._max_workers, len(transfers))
+        with ThreadPoolExecutor(max_workers=max_workers) as executor:
+            futures = [
+                executor.submit(self._transfer_file, src, dst, opts)
+                for src, dst, opts in transfers
+            ]
+            # Re-raise first error after all running transfers finished
+            #   so rollback knows about every transferred file
+            for future in futures:
+                exc = future.exception()
+                if exc is not None:
+                    for _future in futures:
+                        _future.cancel()
+                    raise exc
+
+    def _transfer_file(self, src, dst, opts):
+        if opts["mode"] == self.MODE_COPY:
+            self.log.debug("Copying file ... {} -> {}".format(src, dst))
+            copyfile(src, dst)
+        elif opts["mode"] == self.MODE_HARDLINK:
+            self.log.debug("Hardlinking file ... {} -> {}".format(
+                src, dst))
+            create_hard_link(src, dst)
+
+        with self._transferred_lock:
             self._transferred.append(dst)
 
     def finalize(self):
@@ -196,7 +241,9 @@ class FileTransaction(object):
         return list(self._backup_to_original.keys())
 
     def _create_folder_for_file(self, path):
-        dirname = os.path.dirname(path)
+        self._create_folder(os.path.dirname(path))
+
+    def _create_folder(self, dirname):
         try:
             os.makedirs(dirname)
         except OSError as e:
@@ -0,0 +1,649 @@
+"""Read image information from file headers without OpenImageIO.
+
+Readers return the same structure as 'parse_oiio_xml_output' for output of
+'oiiotool --info -v', so 'get_oiio_info_for_input' can skip spawning
+oiiotool for common formats. Only headers are read, using memory mapped
+file, so the cost does not depend on image size.
+
+Supported formats are OpenEXR (including multipart), DPX, TIFF and PNG.
+Readers return 'None' for anything they don't understand (e.g. BigTIFF,
+unknown DPX descriptor) and caller should fallback to oiiotool.
+"""
+
+import os
+import mmap
+import struct
+
+# OpenEXR
+EXR_MAGIC = 20000630
+EXR_TILED_FLAG = 0x200
+EXR_MULTIPART_FLAG = 0x1000
+EXR_COMPRESSIONS = (
+    "none", "rle", "zips", "zip", "piz", "pxr24", "b44", "b44a", "dwaa",
+    "dwab",
+)
+EXR_PIXEL_TYPES = ("uint", "half", "float")
+EXR_LINE_ORDERS = ("increasingY", "decreasingY", "randomY")
+# Attributes renamed by OIIO
+EXR_ATTRIBUTE_NAMES = {
+    "owner": "Copyright",
+    "comments": "ImageDescription",
+    "capDate": "DateTime",
+    "pixelAspectRatio": "PixelAspectRatio",
+    "expTime": "ExposureTime",
+    "aperture": "FNumber",
+    "lineOrder": "openexr:lineOrder",
+    "name": "oiio:subimagename",
+    "framesPerSecond": "FramesPerSecond",
+}
+# Attributes which are part of image spec
+EXR_SPEC_ATTRIBUTES = {
+    "channels", "dataWindow", "displayWindow", "tiles", "type", "version",
+    "chunkCount", "preview",
+}
+
+# TIFF
+TIFF_TYPE_SIZES = {
+    1: 1, 2: 1, 3: 2, 4: 4, 5: 8, 6: 1, 7: 1, 8: 2, 9: 4, 10: 8, 11: 4,
+    12: 8, 16: 8,
+}
+TIFF_TYPE_FORMATS = {
+    1: "B", 3: "H", 4: "I", 6: "b", 8: "h", 9: "i", 11: "f", 12: "d",
+    16: "Q",
+}
+TIFF_COMPRESSIONS = {
+    1: "none",
+    2: "ccittrle",
+    5: "lzw",
+    7: "jpeg",
+    8: "zip",
+    32773: "packbits",
+    32946: "zip",
+}
+TIFF_STRING_TAGS = {
+    270: "ImageDescription",
+    271: "Make",
+    272: "Model",
+    305: "Software",
+    306: "DateTime",
+    315: "Artist",
+    316: "HostComputer",
+    33432: "Copyright",
+}
+
+# DPX
+DPX_CHANNELS_BY_DESCRIPTOR = {
+    1: ["R"],
+    2: ["G"],
+    3: ["B"],
+    4: ["A"],
+    6: ["Y"],
+    50: ["R", "G", "B"],
+    51: ["R", "G", "B", "A"],
+}
+
+# PNG
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+PNG_TEXT_NAMES = {
+    "Description": "ImageDescription",
+    "Author": "Artist",
+    "Title": "DocumentName",
+}
+
+
+class _HeaderError(Exception):
+    """Header can't be read, oiiotool should be used."""
+
+
+def _uint_format(bits):
+    if bits <= 8:
+        return "uint8"
+    if bits <= 16:
+        return "uint16"
+    return "uint"
+
+
+def _create_spec(width, height, channel_names, pixel_format):
+    alpha_channel = -1
+    z_channel = -1
+    for idx, channel_name in enumerate(channel_names):
+        if channel_name in ("A", "Alpha", "a") and alpha_channel < 0:
+            alpha_channel = idx
+        elif channel_name in ("Z", "Depth") and z_channel < 0:
+            z_channel = idx
+    return {
+        "attribs": {},
+        "x": 0,
+        "y": 0,
+        "z": 0,
+        "width": width,
+        "height": height,
+        "depth": 1,
+        "full_x": 0,
+        "full_y": 0,
+        "full_z": 0,
+        "full_width": width,
+        "full_height": height,
+        "full_depth": 1,
+        "tile_width": 0,
+        "tile_height": 0,
+        "tile_depth": 1,
+        "format": pixel_format,
+        "nchannels": len(channel_names),
+        "channelnames": list(channel_names),
+        "alpha_channel": alpha_channel,
+        "z_channel": z_channel,
+        "deep": 0,
+    }
+
+
+def _find_null(data, offset):
+    idx = data.find(b"\x00", offset)
+    if idx < 0:
+        raise _HeaderError("Unterminated string")
+    return idx
+
+
+def _decode_string(value):
+    return value.decode("utf-8", errors="replace")
+
+
+# --- OpenEXR ---
+def _sort_exr_channels(channel_names):
+    """Sort channels to order used by OIIO.
+
+    Layers are kept in order of their first channel, channels of layer are
+    ordered R, G, B, A and then the rest in original order.
+    """
+    priority = {
+        "r": 0, "red": 0,
+        "g": 1, "green": 1,
+        "b": 2, "blue": 2,
+        "a": 3, "alpha": 3,
+    }
+    layer_order = []
+    channels_by_layer = {}
+    for channel_name in channel_names:
+        layer_name, _, name = channel_name.rpartition(".")
+        if layer_name not in channels_by_layer:
+            layer_order.append(layer_name)
+            channels_by_layer[layer_name] = []
+        channels_by_layer[layer_name].append(channel_name)
+
+    output = []
+    for layer_name in layer_order:
+        channels = channels_by_layer[layer_name]
+        output.extend(sorted(
+            channels,
+            key=lambda item: priority.get(
+                item.rpartition(".")[-1].lower(), 4
+            )
+        ))
+    return output
+
+
+def _read_exr_attribute_value(data, attr_type, start, size):
+    end = start + size
+    if attr_type == "string":
+        return _decode_string(data[start:end])
+
+    if attr_type == "stringvector":
+        output = []
+        offset = start
+        while offset < end:
+            (length, ) = struct.unpack_from("<i", data, offset)
+            offset += 4
+            output.append(_decode_string(data[offset:offset + length]))
+            offset += length
+        return output
+
+    if attr_type in ("box2i", "box2f"):
+        fmt = "<4i" if attr_type == "box2i" else "<4f"
+        return list(struct.unpack_from(fmt, data, start))
+
+    if attr_type == "chlist":
+        channels = []
+        offset = start
+        while offset < end and data[offset:offset + 1] != b"\x00":
+            name_end = _find_null(data, offset)
+            name = _decode_string(data[offset:name_end])
+            (pixel_type, ) = struct.unpack_from("<i", data, name_end + 1)
+            channels.append((name, pixel_type))
+            # pixel type, pLinear, reserved, x and y sampling
+            offset = name_end + 1 + 16
+        return channels
+
+    if attr_type in ("compression", "lineOrder", "envmap", "deepImageState"):
+        return data[start]
+
+    simple_formats = {
+        "int": "<i",
+        "float": "<f",
+        "double": "<d",
+        "v2i": "<2i",
+        "v2f": "<2f",
+        "v2d": "<2d",
+        "v3i": "<3i",
+        "v3f": "<3f",
+        "v3d": "<3d",
+        "m33f": "<9f",
+        "m44f": "<16f",
+        "m33d": "<9d",
+        "m44d": "<16d",
+        "chromaticities": "<8f",
+        "keycode": "<7i",
+        "timecode": "<2I",
+    }
+    fmt = simple_formats.get(attr_type)
+    if fmt is not None:
+        values = struct.unpack_from(fmt, data, start)
+        if len(values) == 1:
+            return values[0]
+        return list(values)
+
+    if attr_type == "rational":
+        numerator, denominator = struct.unpack_from("<iI", data, start)
+        return "{}/{}".format(numerator, denominator)
+
+    if attr_type == "tiledesc":
+        tile_x, tile_y = struct.unpack_from("<II", data, start)
+        return [tile_x, tile_y]
+
+    # Unknown or custom type, value can't be represented
+    return None
+
+
+def _read_exr_header(data, offset):
+    """Read attributes of one header.
+
+    Returns:
+        tuple[dict[str, tuple[str, Any]], int]: Attributes by name with
+            type and offset after header.
+    """
+    attributes = {}
+    while True:
+        if data[offset:offset + 1] == b"\x00":
+            return attributes, offset + 1
+
+        name_end = _find_null(data, offset)
+        type_end = _find_null(data, name_end + 1)
+        name = _decode_string(data[offset:name_end])
+        attr_type = _decode_string(data[name_end + 1:type_end])
+        (size, ) = struct.unpack_from("<i", data, type_end + 1)
+        value_start = type_end + 5
+        if size < 0 or value_start + size > len(data):
+            raise _HeaderError("Invalid attribute size")
+        attributes[name] = (
+            attr_type,
+            _read_exr_attribute_value(data, attr_type, value_start, size)
+        )
+        offset = value_start + size
+
+
+def _exr_header_to_spec(attributes, is_tiled):
+    data_window = attributes["dataWindow"][1]
+    display_window = attributes.get("displayWindow", (None, data_window))[1]
+    channels = attributes["channels"][1]
+    if not channels:
+        raise _HeaderError("No channels")
+
+    channel_names = _sort_exr_channels([name for name, _ in channels])
+    pixel_types = {pixel_type for _, pixel_type in channels}
+    pixel_format = EXR_PIXEL_TYPES[max(pixel_types)]
+
+    spec = _create_spec(
+        data_window[2] - data_window[0] + 1,
+        data_window[3] - data_window[1] + 1,
+        channel_names,
+        pixel_format,
+    )
+    spec["x"] = data_window[0]
+    spec["y"] = data_window[1]
+    spec["full_x"] = display_window[0]
+    spec["full_y"] = display_window[1]
+    spec["full_width"] = display_window[2] - display_window[0] + 1
+    spec["full_height"] = display_window[3] - display_window[1] + 1
+
+    part_type = attributes.get("type", (None, None))[1]
+    if part_type:
+        if part_type.startswith("deep"):
+            spec["deep"] = 1
+        is_tiled = part_type in ("tiledimage", "deeptile")
+
+    tiles = attributes.get("tiles")
+    if is_tiled and tiles is not None:
+        spec["tile_width"], spec["tile_height"] = tiles[1]
+
+    attribs = spec["attribs"]
+    for name, (attr_type, value) in attributes.items():
+        if name in EXR_SPEC_ATTRIBUTES or value is None:
+            continue
+
+        if attr_type == "compression":
+            if value >= len(EXR_COMPRESSIONS):
+                raise _HeaderError("Unknown compression")
+            value = EXR_COMPRESSIONS[value]
+        elif attr_type == "lineOrder":
+            if value < len(EXR_LINE_ORDERS):
+                value = EXR_LINE_ORDERS[value]
+
+        attribs[EXR_ATTRIBUTE_NAMES.get(name, name)] = value
+    return spec
+
+
+def _read_exr(data):
+    magic, version = struct.unpack_from("<iI", data, 0)
+    if magic != EXR_MAGIC:
+        raise _HeaderError("Not an OpenEXR file")
+
+    is_multipart = bool(version & EXR_MULTIPART_FLAG)
+    is_tiled = bool(version & EXR_TILED_FLAG)
+    offset = 8
+    specs = []
+    while True:
+        attributes, offset = _read_exr_header(data, offset)
+        specs.append(_exr_header_to_spec(attributes, is_tiled))
+        if not is_multipart or data[offset:offset + 1] == b"\x00":
+            break
+
+    if len(specs) > 1:
+        for spec in specs:
+            spec["subimages"] = len(specs)
+    return specs
+
+
+# --- DPX ---
+def _read_dpx(data):
+    magic = data[0:4]
+    if magic == b"SDPX":
+        endian = ">"
+    elif magic == b"XPDS":
+        endian = "<"
+    else:
+        raise _HeaderError("Not a DPX file")
+
+    if len(data) < 808:
+        raise _HeaderError("Truncated DPX header")
+
+    (elements, ) = struct.unpack_from(endian + "H", data, 770)
+    width, height = struct.unpack_from(endian + "II", data, 772)
+    descriptor = data[800]
+    bit_size = data[803]
+    channel_names = DPX_CHANNELS_BY_DESCRIPTOR.get(descriptor)
+    if elements != 1 or channel_names is None:
+        raise _HeaderError("Unsupported DPX image element")
+
+    if bit_size == 32:
+        pixel_format = "float"
+    elif bit_size == 64:
+        pixel_format = "double"
+    else:
+        pixel_format = _uint_format(bit_size)
+
+    spec = _create_spec(width, height, channel_names, pixel_format)
+    attribs = spec["attribs"]
+    attribs["oiio:BitsPerSample"] = bit_size
+    # Creator, project and copyright strings of file information header
+    for name, start, size in (
+        ("Software", 100, 100),
+        ("DocumentName", 200, 200),
+        ("Copyright", 400, 200),
+    ):
+        value = _decode_string(data[start:start + size].split(b"\x00")[0])
+        if value:
+            attribs[name] = value
+    return [spec]
+
+
+# --- TIFF ---
+def _read_tiff_entries(data, endian, offset):
+    (count, ) = struct.unpack_from(endian + "H", data, offset)
+    entries = {}
+    for idx in range(count):
+        entry_offset = offset + 2 + (idx * 12)
+        tag, value_type, value_count = struct.unpack_from(
+            endian + "HHI", data, entry_offset
+        )
+        type_size = TIFF_TYPE_SIZES.get(value_type)
+        if type_size is None:
+            continue
+        size = type_size * value_count
+        value_offset = entry_offset + 8
+        if size > 4:
+            (value_offset, ) = struct.unpack_from(
+                endian + "I", data, value_offset
+            )
+        if value_offset + size > len(data):
+            raise _HeaderError("Invalid TIFF entry")
+
+        if value_type in (2, 7):
+            value = data[value_offset:value_offset + size]
+            if value_type == 2:
+                value = _decode_string(value.rstrip(b"\x00"))
+        elif value_type in (5, 10):
+            fmt = "I" if value_type == 5 else "i"
+            parts = struct.unpack_from(
+                endian + fmt * 2 * value_count, data, value_offset
+            )
+            value = [
+                parts[i] / parts[i + 1] if parts[i + 1] else 0.0
+                for i in range(0, len(parts), 2)
+            ]
+        else:
+            value = list(struct.unpack_from(
+                endian + TIFF_TYPE_FORMATS[value_type] * value_count,
+                data,
+                value_offset
+            ))
+        entries[tag] = value
+
+    (next_offset, ) = struct.unpack_from(
+        endian + "I", data, offset + 2 + (count * 12)
+    )
+    return entries, next_offset
+
+
+def _tiff_entries_to_spec(entries):
+    def get_first(tag, default=None):
+        value = entries.get(tag)
+        if not value:
+            return default
+        return value[0]
+
+    width = get_first(256)
+    height = get_first(257)
+    if not width or not height:
+        raise _HeaderError("Missing TIFF size")
+
+    samples = get_first(277, 1)
+    bits = get_first(258, 1)
+    sample_format = get_first(339, 1)
+    photometric = get_first(262)
+    if photometric not in (0, 1, 2):
+        # Palette, CMYK, YCbCr, ... are converted by OIIO
+        raise _HeaderError("Unsupported TIFF photometric")
+
+    if photometric == 2:
+        base_channels = ["R", "G", "B"]
+    else:
+        base_channels = ["Y"]
+
+    if samples < len(base_channels):
+        raise _HeaderError("Invalid TIFF samples")
+    extra_count = samples - len(base_channels)
+    if extra_count > 1:
+        raise _HeaderError("Unsupported TIFF extra samples")
+    channel_names = list(base_channels)
+    if extra_count:
+        channel_names.append("A")
+
+    if sample_format == 3:
+        pixel_format = {16: "half", 32: "float", 64: "double"}.get(bits)
+    elif sample_format == 2:
+        pixel_format = {8: "int8", 16: "int16", 32: "int"}.get(bits)
+    else:
+        pixel_format = _uint_format(bits)
+    if pixel_format is None:
+        raise _HeaderError("Unsupported TIFF sample format")
+
+    spec = _create_spec(width, height, channel_names, pixel_format)
+    tile_width = get_first(322)
+    tile_height = get_first(323)
+    if tile_width and tile_height:
+        spec["tile_width"] = tile_width
+        spec["tile_height"] = tile_height
+
+    attribs = spec["attribs"]
+    compression = get_first(259, 1)
+    attribs["compression"] = TIFF_COMPRESSIONS.get(compression, "unknown")
+    attribs["tiff:Compression"] = compression
+    attribs["tiff:PhotometricInterpretation"] = photometric
+    attribs["oiio:BitsPerSample"] = bits
+    for tag, name in TIFF_STRING_TAGS.items():
+        value = entries.get(tag)
+        if isinstance(value, str) and value:
+            attribs[name] = value
+    return spec
+
+
+def _read_tiff(data):
+    byte_order = data[0:4]
+    if byte_order == b"II*\x00":
+        endian = "<"
+    elif byte_order == b"MM\x00*":
+        endian = ">"
+    else:
+        # BigTIFF or not a TIFF file
+        raise _HeaderError("Not a supported TIFF file")
+
+    (offset, ) = struct.unpack_from(endian + "I", data, 4)
+    entries, next_offset = _read_tiff_entries(data, endian, offset)
+    if next_offset:
+        # Multiple directories may be subimages or mip levels
+        raise _HeaderError("Multiple TIFF directories")
+    return [_tiff_entries_to_spec(entries)]
+
+
+# --- PNG ---
+def _read_png(data):
+    if data[0:8] != PNG_SIGNATURE:
+        raise _HeaderError("Not a PNG file")
+
+    offset = 8
+    header = None
+    has_transparency = False
+    texts = {}
+    while offset + 8 <= len(data):
+        length, chunk_type = struct.unpack_from(">I4s", data, offset)
+        chunk_start = offset + 8
+        chunk_end = chunk_start + length
+        if chunk_type == b"IHDR":
+            header = struct.unpack_from(">IIBB", data, chunk_start)
+        elif chunk_type == b"tRNS":
+            has_transparency = True
+        elif chunk_type == b"tEXt":
+            key, _, text = data[chunk_start:chunk_end].partition(b"\x00")
+            texts[_decode_string(key)] = text.decode(
+                "latin-1", errors="replace"
+            )
+        elif chunk_type in (b"IDAT", b"IEND"):
+            break
+        # Skip data and crc
+        offset = chunk_end + 4
+
+    if header is None:
+        raise _HeaderError("Missing PNG header")
+
+    width, height, bit_depth, color_type = header
+    if color_type == 0:
+        channel_names = ["Y"]
+    elif color_type == 4:
+        channel_names = ["Y", "A"]
+    elif color_type in (2, 3):
+        channel_names = ["R", "G", "B"]
+    elif color_type == 6:
+        channel_names = ["R", "G", "B", "A"]
+    else:
+        raise _HeaderError("Unknown PNG color type")
+
+    if has_transparency and "A" not in channel_names:
+        channel_names.append("A")
+
+    if color_type == 3:
+        # Palette is expanded to 8 bit
+        bit_depth = 8
+
+    spec = _create_spec(
+        width, height, channel_names, _uint_format(bit_depth)
+    )
+    attribs = spec["attribs"]
+    attribs["oiio:BitsPerSample"] = bit_depth
+    for key, text in texts.items():
+        attribs[PNG_TEXT_NAMES.get(key, key)] = text
+    return [spec]
+
+
+_READERS_BY_EXT = {
+    ".exr": _read_exr,
+    ".sxr": _read_exr,
+    ".mxr": _read_exr,
+    ".dpx": _read_dpx,
+    ".tif": _read_tiff,
+    ".tiff": _read_tiff,
+    ".png": _read_png,
+}
+
+
+def is_image_header_supported(filepath):
+    """Image information can be read from header of the file.
+
+    Args:
+        filepath (str): Path to image.
+
+    Returns:
+        bool: Extension of file is supported.
+
+    """
+    ext = os.path.splitext(filepath)[-1].lower()
+    return ext in _READERS_BY_EXT
+
+
+def read_image_header_info(filepath, subimages=False):
+    """Read image information from header of the file.
+
+    Output has the same structure as 'get_oiio_info_for_input'.
+
+    Args:
+        filepath (str): Path to image.
+        subimages (Optional[bool]): Return information of all subimages.
+
+    Returns:
+        Union[dict[str, Any], list[dict[str, Any]], None]: Image information
+            or 'None' if header could not be read.
+
+    """
+    ext = os.path.splitext(filepath)[-1].lower()
+    reader = _READERS_BY_EXT.get(ext)
+    if reader is None:
+        return None
+
+    try:
+        with open(filepath, "rb") as stream:
+            with mmap.mmap(
+                stream.fileno(), 0, access=mmap.ACCESS_READ
+            ) as data:
+                specs = reader(data)
+
+    except (
+        _HeaderError,
+        OSError,
+        ValueError,
+        IndexError,
+        KeyError,
+        struct.error,
+    ):
+        return None
+
+    if subimages:
+        return specs
+    return specs[0]
@@ -1,7 +1,10 @@
 import os
 import re
+import fnmatch
 import logging
 import platform
+import threading
+from concurrent.futures import ThreadPoolExecutor
 
 import clique
 
@@ -102,6 +105,192 @@ def collect_frames(files):
     return sources_and_frames
 
 
+def _compile_filename_pattern(pattern):
+    if pattern is None or hasattr(pattern, "match"):
+        return pattern
+    return re.compile(fnmatch.translate(pattern))
+
+
+def scan_directory(dirpath, pattern=None):
+    """Stream names of files in directory.
+
+    Uses 'os.scandir' so file type is known without additional stat call
+    on most platforms.
+
+    Args:
+        dirpath (str): Path to directory.
+        pattern (Optional[Union[str, re.Pattern]]): Glob pattern or compiled
+            regex filenames must match.
+
+    Yields:
+        str: Filename of file in directory.
+    """
+
+    pattern = _compile_filename_pattern(pattern)
+    with os.scandir(dirpath) as scan_iter:
+        for entry in scan_iter:
+            if pattern is not None and not pattern.match(entry.name):
+                continue
+            try:
+                if not entry.is_file():
+                    continue
+            except OSError:
+                continue
+            yield entry.name
+
+
+class DirectoryScanner:
+    """Cached scanning of directories.
+
+    Listing of directory is cached with modification time of the directory,
+    so repeated scans of the same directory (e.g. render output folder
+    used by multiple instances) don't list the directory again. Cached
+    listing is used only if modification time did not change.
+
+    Args:
+        max_workers (Optional[int]): Maximum number of threads used to
+            scan multiple directories.
+    """
+
+    def __init__(self, max_workers=8):
+        self._max_workers = max_workers
+        self._lock = threading.Lock()
+        # Cached filenames and mtime by normalized directory path
+        self._cache = {}
+
+    def reset(self, dirpath=None):
+        """Drop cached listings.
+
+        Args:
+            dirpath (Optional[str]): Drop only listing of the directory.
+        """
+
+        with self._lock:
+            if dirpath is None:
+                self._cache = {}
+            else:
+                self._cache.pop(os.path.normpath(dirpath), None)
+
+    def _get_mtime(self, dirpath):
+        try:
+            return os.stat(dirpath).st_mtime_ns
+        except OSError:
+            return None
+
+    def _get_cached(self, dirpath):
+        with self._lock:
+            cached = self._cache.get(dirpath)
+        if cached is None:
+            return None
+        mtime, filenames = cached
+        if mtime is None or mtime != self._get_mtime(dirpath):
+            return None
+        return filenames
+
+    def _scan(self, dirpath):
+        mtime = self._get_mtime(dirpath)
+        filenames = frozenset(scan_directory(dirpath))
+        with self._lock:
+            self._cache[dirpath] = (mtime, filenames)
+        return filenames
+
+    def get_filenames(self, dirpath, pattern=None):
+        """Filenames in directory.
+
+        Args:
+            dirpath (str): Path to directory.
+            pattern (Optional[Union[str, re.Pattern]]): Glob pattern or
+                compiled regex filenames must match.
+
+        Returns:
+            set[str]: Filenames of files in directory.
+        """
+
+        dirpath = os.path.normpath(dirpath)
+        filenames = self._get_cached(dirpath)
+        if filenames is None:
+            filenames = self._scan(dirpath)
+
+        pattern = _compile_filename_pattern(pattern)
+        if pattern is None:
+            return set(filenames)
+        return {
+            filename
+            for filename in filenames
+            if pattern.match(filename)
+        }
+
+    def iter_filenames(self, dirpath, pattern=None):
+        """Stream filenames in directory.
+
+        Filenames are yielded while directory is scanned. Listing is cached
+        only when all filenames were consumed.
+
+        Args:
+            dirpath (str): Path to directory.
+            pattern (Optional[Union[str, re.Pattern]]): Glob pattern or
+                compiled regex filenames must match.
+
+        Yields:
+            str: Filename of file in directory.
+        """
+
+        dirpath = os.path.normpath(dirpath)
+        pattern = _compile_filename_pattern(pattern)
+        filenames = self._get_cached(dirpath)
+        if filenames is not None:
+            for filename in filenames:
+                if pattern is None or pattern.match(filename):
+                    yield filename
+            return
+
+        mtime = self._get_mtime(dirpath)
+        scanned = []
+        for filename in scan_directory(dirpath):
+            scanned.append(filename)
+            if pattern is None or pattern.match(filename):
+                yield filename
+
+        with self._lock:
+            self._cache[dirpath] = (mtime, frozenset(scanned))
+
+    def prefetch(self, dirpaths):
+        """Scan multiple directories in parallel.
+
+        Directories which don't exist are skipped.
+
+        Args:
+            dirpaths (Iterable[str]): Paths to directories.
+        """
+
+        dirpaths = {
+            os.path.normpath(dirpath)
+            for dirpath in dirpaths
+        }
+        dirpaths = [
+            dirpath
+            for dirpath in dirpaths
+            if self._get_cached(dirpath) is None
+        ]
+        if not dirpaths:
+            return
+
+        def _scan(dirpath):
+            try:
+                self._scan(dirpath)
+            except OSError:
+                pass
+
+        if len(dirpaths) == 1 or self._max_workers < 2:
+            for dirpath in dirpaths:
+                _scan(dirpath)
+            return
+
+        max_workers = min(self._max_workers, len(dirpaths))
+        with ThreadPoolExecutor(max_workers=max_workers) as executor:
+            list(executor.map(_scan, dirpaths))
+
+
 def _rreplace(s, a, b, n=1):
     """Replace a with b in string s from right side n times."""
     return b.join(s.rsplit(a, n))
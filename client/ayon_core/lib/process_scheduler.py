@@ -0,0 +1,369 @@
+"""Shared scheduler of media processes (ffmpeg, oiiotool, ...).
+
+Extractors can submit commands to one scheduler per process instead of
+calling 'run_subprocess' directly, so processes started from different
+plugins or threads share the same cpu and memory budget of the machine.
+
+Example:
+    >>> scheduler = get_process_scheduler()
+    >>> jobs = [
+    ...     scheduler.submit(args, memory_mb=2048, label="review")
+    ...     for args in commands
+    ... ]
+    >>> scheduler.wait(jobs)
+
+Budgets can be changed with environment variables:
+    AYON_PROCESS_SCHEDULER_MAX_JOBS: Maximum number of running processes.
+    AYON_PROCESS_SCHEDULER_CPU_BUDGET: Cores available for processes.
+    AYON_PROCESS_SCHEDULER_MEMORY_MB: Memory available for processes.
+"""
+
+import os
+import time
+import heapq
+import itertools
+import threading
+
+from .log import Logger
+from .execute import run_subprocess
+
+
+class ProcessPriority:
+    """Jobs with lower value are started first."""
+    INTERACTIVE = 0
+    NORMAL = 50
+    FARM = 100
+
+
+class ProcessJobState:
+    QUEUED = "queued"
+    RUNNING = "running"
+    FINISHED = "finished"
+    FAILED = "failed"
+
+
+class ProcessJob:
+    """Process submitted to scheduler.
+
+    Args:
+        args (Union[str, list[str]]): Process arguments.
+        kwargs (dict[str, Any]): Keyword arguments for 'run_subprocess'.
+        priority (int): Priority of job, see 'ProcessPriority'.
+        cores (int): Cores used by process.
+        memory_mb (int): Expected memory used by process in MB.
+        label (str): Label used in logs and timing reports.
+
+    """
+    def __init__(self, args, kwargs, priority, cores, memory_mb, label):
+        self.args = args
+        self.kwargs = kwargs
+        self.priority = priority
+        self.cores = cores
+        self.memory_mb = memory_mb
+        self.label = label
+
+        self.state = ProcessJobState.QUEUED
+        self.output = None
+        self.exception = None
+        self.queued_time = time.time()
+        self.start_time = None
+        self.end_time = None
+        self._done_event = threading.Event()
+
+    @property
+    def is_done(self):
+        return self._done_event.is_set()
+
+    @property
+    def wait_duration(self):
+        """Seconds the job waited in queue."""
+        if self.start_time is None:
+            return None
+        return self.start_time - self.queued_time
+
+    @property
+    def duration(self):
+        """Seconds the process was running."""
+        if self.start_time is None or self.end_time is None:
+            return None
+        return self.end_time - self.start_time
+
+    def wait(self, timeout=None):
+        """Wait until process is finished.
+
+        Returns:
+            bool: Job is done.
+
+        """
+        return self._done_event.wait(timeout)
+
+    def result(self, timeout=None):
+        """Output of process.
+
+        Returns:
+            str: Output of process.
+
+        Raises:
+            TimeoutError: Process did not finish in time.
+            RuntimeError: Process failed.
+
+        """
+        if not self.wait(timeout):
+            raise TimeoutError(
+                "Process '{}' did not finish in time".format(self.label)
+            )
+        if self.exception is not None:
+            raise self.exception
+        return self.output
+
+    def get_timing_data(self):
+        return {
+            "label": self.label,
+            "state": self.state,
+            "priority": self.priority,
+            "wait_duration": self.wait_duration,
+            "duration": self.duration,
+        }
+
+    def _set_running(self):
+        self.state = ProcessJobState.RUNNING
+        self.start_time = time.time()
+
+    def _set_done(self, output=None, exception=None):
+        self.end_time = time.time()
+        self.output = output
+        self.exception = exception
+        if exception is None:
+            self.state = ProcessJobState.FINISHED
+        else:
+            self.state = ProcessJobState.FAILED
+        self._done_event.set()
+
+
+class ProcessScheduler:
+    """Run processes with limited cpu and memory budget.
+
+    Queued jobs are started by priority. A job is started when its cores
+    and memory fit into remaining budget, or when nothing else is running
+    so jobs bigger than the budget are not blocked forever. Jobs are not
+    reordered by size to not starve big jobs.
+
+    Args:
+        max_jobs (Optional[int]): Maximum number of running processes.
+        cpu_budget (Optional[int]): Cores available for processes. Cpu
+            count is used by default.
+        memory_budget_mb (Optional[int]): Memory available for processes
+            in MB. Available memory is used by default if 'psutil' is
+            available, otherwise memory is not limited.
+        logger (Optional[logging.Logger]): Logger used for output.
+
+    """
+    def __init__(
+        self,
+        max_jobs=None,
+        cpu_budget=None,
+        memory_budget_mb=None,
+        logger=None
+    ):
+        if logger is None:
+            logger = Logger.get_logger(self.__class__.__name__)
+
+        if max_jobs is None:
+            max_jobs = _get_env_int("AYON_PROCESS_SCHEDULER_MAX_JOBS")
+
+        if cpu_budget is None:
+            cpu_budget = _get_env_int("AYON_PROCESS_SCHEDULER_CPU_BUDGET")
+        if cpu_budget is None:
+            cpu_budget = os.cpu_count() or 1
+
+        if memory_budget_mb is None:
+            memory_budget_mb = _get_env_int(
+                "AYON_PROCESS_SCHEDULER_MEMORY_MB"
+            )
+        if memory_budget_mb is None:
+            memory_budget_mb = _get_available_memory_mb()
+
+        self.log = logger
+        self.max_jobs = max_jobs
+        self.cpu_budget = cpu_budget
+        self.memory_budget_mb = memory_budget_mb
+
+        self._queue = []
+        self._counter = itertools.count()
+        self._running = set()
+        self._used_cores = 0
+        self._used_memory_mb = 0
+        self._lock = threading.Lock()
+
+    def submit(
+        self,
+        args,
+        priority=None,
+        cores=1,
+        memory_mb=0,
+        label=None,
+        **kwargs
+    ):
+        """Queue process.
+
+        Args:
+            args (Union[str, list[str]]): Process arguments.
+            priority (Optional[int]): Priority of job, see
+                'ProcessPriority'.
+            cores (Optional[int]): Cores used by process.
+            memory_mb (Optional[int]): Expected memory used by process
+                in MB.
+            label (Optional[str]): Label used in logs.
+            **kwargs: Keyword arguments passed to 'run_subprocess'.
+
+        Returns:
+            ProcessJob: Queued job.
+
+        """
+        if priority is None:
+            priority = ProcessPriority.NORMAL
+        if label is None:
+            label = args if isinstance(args, str) else " ".join(args)
+        job = ProcessJob(
+            args, kwargs, priority, max(1, cores), max(0, memory_mb), label
+        )
+        with self._lock:
+            heapq.heappush(
+                self._queue, (job.priority, next(self._counter), job)
+            )
+        self._dispatch()
+        return job
+
+    def run(self, args, **kwargs):
+        """Submit process and wait for its output.
+
+        Returns:
+            str: Output of process.
+
+        """
+        return self.submit(args, **kwargs).result()
+
+    def wait(self, jobs, timeout=None):
+        """Wait for jobs and raise error of first failed job.
+
+        All jobs are finished before the error is raised.
+
+        Args:
+            jobs (Iterable[ProcessJob]): Submitted jobs.
+            timeout (Optional[float]): Maximum wait time in seconds.
+
+        Returns:
+            list[str]: Output of jobs.
+
+        """
+        jobs = list(jobs)
+        end_time = None
+        if timeout is not None:
+            end_time = time.time() + timeout
+
+        for job in jobs:
+            remaining = None
+            if end_time is not None:
+                remaining = max(0, end_time - time.time())
+            job.wait(remaining)
+
+        return [job.result(0) for job in jobs]
+
+    def _can_start(self, job):
+        if not self._running:
+            return True
+        if (
+            self.max_jobs is not None
+            and len(self._running) >= self.max_jobs
+        ):
+            return False
+        if self._used_cores + job.cores > self.cpu_budget:
+            return False
+        if (
+            self.memory_budget_mb is not None
+            and self._used_memory_mb + job.memory_mb > self.memory_budget_mb
+        ):
+            return False
+        return True
+
+    def _dispatch(self):
+        jobs_to_start = []
+        with self._lock:
+            while self._queue:
+                job = self._queue[0][2]
+                if not self._can_start(job):
+                    break
+                heapq.heappop(self._queue)
+                self._running.add(job)
+                self._used_cores += job.cores
+                self._used_memory_mb += job.memory_mb
+                jobs_to_start.append(job)
+
+        for job in jobs_to_start:
+            thread = threading.Thread(
+                target=self._run_job,
+                args=(job, ),
+                name="ProcessSchedulerJob",
+                daemon=True
+            )
+            thread.start()
+
+    def _run_job(self, job):
+        job._set_running()
+        kwargs = dict(job.kwargs)
+        kwargs.setdefault("logger", self.log)
+        output = exception = None
+        try:
+            output = run_subprocess(job.args, **kwargs)
+        except Exception as exc:
+            exception = exc
+
+        with self._lock:
+            self._running.discard(job)
+            self._used_cores -= job.cores
+            self._used_memory_mb -= job.memory_mb
+
+        job._set_done(output, exception)
+        self.log.debug(
+            "Process '{}' {} in {:.2f}s (waited {:.2f}s)".format(
+                job.label, job.state, job.duration, job.wait_duration
+            )
+        )
+        self._dispatch()
+
+
+def _get_env_int(env_key):
+    value = os.environ.get(env_key)
+    if not value:
+        return None
+    try:
+        return int(value)
+    except ValueError:
+        return None
+
+
+def _get_available_memory_mb():
+    try:
+        import psutil
+
+        return psutil.virtual_memory().available // (1024 ** 2)
+    except Exception:
+        return None
+
+
+_scheduler = None
+_scheduler_lock = threading.Lock()
+
+
+def get_process_scheduler():
+    """Scheduler shared by all extractors of current process.
+
+    Returns:
+        ProcessScheduler: Shared scheduler.
+
+    """
+    global _scheduler
+    with _scheduler_lock:
+        if _scheduler is None:
+            _scheduler = ProcessScheduler()
+    return _scheduler
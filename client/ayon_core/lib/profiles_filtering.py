@@ -1,8 +1,15 @@
 import re
 import logging
+import threading
+import collections
 
 log = logging.getLogger(__name__)
 
+# Maximum number of cached profiles matchers
+_MATCHERS_CACHE_SIZE = 128
+# Maximum number of cached results of one matcher
+_RESULTS_CACHE_SIZE = 1024
+
 
 def compile_list_of_regexes(in_list):
     """Convert strings in entered list to compiled regex objects."""
@@ -116,6 +123,287 @@ def validate_value_by_regexes(value, in_list):
     return -1
 
 
+def _freeze_value(value):
+    """Convert value to hashable object usable as cache key.
+
+    Raises:
+        TypeError: When value can't be converted to hashable object.
+
+    """
+    if isinstance(value, (list, tuple, set)):
+        return tuple(_freeze_value(item) for item in value)
+    hash(value)
+    return value
+
+
+class _CompiledFilter:
+    """Pre-compiled filter values of one profile key.
+
+    Args:
+        in_list (Any): Profile value of key.
+
+    """
+    def __init__(self, in_list):
+        if in_list and not isinstance(in_list, (list, tuple, set)):
+            in_list = [in_list]
+
+        self.in_list = in_list or []
+        self.is_wildcard = not in_list or "*" in in_list
+        self.regexes = []
+        if not self.is_wildcard:
+            self.regexes = compile_list_of_regexes(in_list)
+
+    def validate(self, value):
+        """Same logic as 'validate_value_by_regexes'.
+
+        Args:
+            value (str): String where regexes is checked.
+
+        Returns:
+            int: Returns `0` when filter is not set, is empty or contain "*".
+                Returns `1` when any regex match value and returns `-1`
+                when none of regexes match entered value.
+
+        """
+        if self.is_wildcard:
+            return 0
+
+        if not value:
+            return -1
+
+        for regex in self.regexes:
+            if regex.fullmatch(value):
+                return 1
+        return -1
+
+
+class ProfilesMatcher:
+    """Find most matching profile from pre-compiled profiles.
+
+    Regexes of profiles are compiled once per key and results are cached
+    by passed key values, least recently used results are removed when
+    cache is full. Matcher expects that profiles are not changed after
+    creation.
+
+    Use 'get_profiles_matcher' to get matcher shared for the same
+    profiles object.
+
+    Args:
+        profiles_data (list[dict[str, Any]]): Profile definitions.
+
+    """
+    def __init__(self, profiles_data):
+        self._profiles = list(profiles_data or [])
+        self._filters_by_key = {}
+        self._results_cache = collections.OrderedDict()
+        self._lock = threading.Lock()
+
+    @property
+    def profiles_count(self):
+        return len(self._profiles)
+
+    def _get_filters(self, key):
+        filters = self._filters_by_key.get(key)
+        if filters is None:
+            filters = [
+                _CompiledFilter(profile.get(key))
+                for profile in self._profiles
+            ]
+            self._filters_by_key[key] = filters
+        return filters
+
+    def filter(self, key_values, keys_order=None, logger=None):
+        """Find most matching profile for passed key values.
+
+        Args:
+            key_values (dict): Mapping of Key <-> Value. Key is checked if is
+                available in profile and if Value is matching it's values.
+            keys_order (list, tuple): Order of keys from `key_values` which
+                matters only when multiple profiles have same score.
+            logger (logging.Logger): Optionally can be passed different
+                logger.
+
+        Returns:
+            dict/None: Return most matching profile or None if none of
+                profiles match at least one criteria.
+
+        """
+        if not self._profiles:
+            return None
+
+        if not logger:
+            logger = log
+
+        if not keys_order:
+            keys_order = tuple(key_values.keys())
+        else:
+            _keys_order = list(keys_order)
+            # Make all keys from `key_values` are passed
+            for key in key_values.keys():
+                if key not in _keys_order:
+                    _keys_order.append(key)
+            keys_order = tuple(_keys_order)
+
+        try:
+            cache_key = tuple(
+                (key, _freeze_value(key_values[key]))
+                for key in keys_order
+            )
+        except TypeError:
+            cache_key = None
+
+        with self._lock:
+            if cache_key is not None and cache_key in self._results_cache:
+                self._results_cache.move_to_end(cache_key)
+                return self._results_cache[cache_key]
+
+            profile = self._filter(key_values, keys_order, logger)
+            if cache_key is not None:
+                self._results_cache[cache_key] = profile
+                if len(self._results_cache) > _RESULTS_CACHE_SIZE:
+                    self._results_cache.popitem(last=False)
+        return profile
+
+    def _filter(self, key_values, keys_order, logger):
+        log_debug = logger.isEnabledFor(logging.DEBUG)
+        log_parts = None
+        if log_debug:
+            log_parts = " | ".join([
+                "{}: \"{}\"".format(*item)
+                for item in key_values.items()
+            ])
+            logger.debug(
+                "Looking for matching profile for: {}".format(log_parts)
+            )
+
+        filters_by_key = [
+            (key, key_values[key], self._get_filters(key))
+            for key in keys_order
+        ]
+
+        matching_profiles = None
+        highest_profile_points = -1
+        # Each profile get 1 point for each matching filter. Profile with most
+        # points is returned. For cases when more than one profile will match
+        # are also stored ordered lists of matching values.
+        for idx, profile in enumerate(self._profiles):
+            profile_points = 0
+            profile_scores = []
+
+            for key, value, filters in filters_by_key:
+                compiled_filter = filters[idx]
+                match = compiled_filter.validate(value)
+                if match == -1:
+                    if log_debug:
+                        logger.debug(
+                            "\"{}\" not found in \"{}\": {}".format(
+                                value, key, compiled_filter.in_list
+                            )
+                        )
+                    profile_points = -1
+                    break
+
+                profile_points += match
+                profile_scores.append(bool(match))
+
+            if (
+                profile_points < 0
+                or profile_points < highest_profile_points
+            ):
+                continue
+
+            if profile_points > highest_profile_points:
+                matching_profiles = []
+                highest_profile_points = profile_points
+
+            if profile_points == highest_profile_points:
+                matching_profiles.append((profile, profile_scores))
+
+        if not matching_profiles:
+            if log_debug:
+                logger.debug(
+                    "None of profiles match your setup. {}".format(log_parts)
+                )
+            return None
+
+        if len(matching_profiles) > 1 and log_debug:
+            logger.debug(
+                "More than one profile match your setup. {}".format(log_parts)
+            )
+
+        profile = _profile_exclusion(matching_profiles, logger)
+        if profile and log_debug:
+            logger.debug(
+                "Profile selected: {}".format(profile)
+            )
+        return profile
+
+
+class _ProfilesMatchersCache:
+    """Cache of profiles matchers by identity of profiles object.
+
+    Settings are loaded once and plugins keep reference to the same profiles
+    list, so matcher can be reused for the lifetime of that object. Cached
+    profiles objects are referenced to avoid reuse of their ids.
+
+    """
+    def __init__(self, size):
+        self._size = size
+        self._items = collections.OrderedDict()
+        self._lock = threading.Lock()
+
+    def get(self, profiles_data):
+        key = id(profiles_data)
+        with self._lock:
+            item = self._items.get(key)
+            if (
+                item is not None
+                and item[0] is profiles_data
+                and item[1].profiles_count == len(profiles_data)
+            ):
+                self._items.move_to_end(key)
+                return item[1]
+
+            matcher = ProfilesMatcher(profiles_data)
+            self._items[key] = (profiles_data, matcher)
+            self._items.move_to_end(key)
+            while len(self._items) > self._size:
+                self._items.popitem(last=False)
+        return matcher
+
+    def clear(self):
+        with self._lock:
+            self._items.clear()
+
+
+_matchers_cache = _ProfilesMatchersCache(_MATCHERS_CACHE_SIZE)
+
+
+def get_profiles_matcher(profiles_data):
+    """Get profiles matcher for passed profiles.
+
+    The same matcher is returned for the same profiles object.
+
+    Args:
+        profiles_data (list[dict[str, Any]]): Profile definitions.
+
+    Returns:
+        ProfilesMatcher: Matcher of profiles.
+
+    """
+    if not isinstance(profiles_data, list):
+        return ProfilesMatcher(profiles_data)
+    return _matchers_cache.get(profiles_data)
+
+
+def clear_profiles_matchers_cache():
+    """Clear cached profiles matchers.
+
+    Should be called when profiles were changed in place.
+    """
+    _matchers_cache.clear()
+
+
 def filter_profiles(profiles_data, key_values, keys_order=None, logger=None):
     """ Filter profiles by entered key -> values.
 
@@ -149,79 +437,5 @@ def filter_profiles(profiles_data, key_values, keys_order=None, logger=None):
     if not profiles_data:
         return None
 
-    if not logger:
-        logger = log
-
-    if not keys_order:
-        keys_order = tuple(key_values.keys())
-    else:
-        _keys_order = list(keys_order)
-        # Make all keys from `key_values` are passed
-        for key in key_values.keys():
-            if key not in _keys_order:
-                _keys_order.append(key)
-        keys_order = tuple(_keys_order)
-
-    log_parts = " | ".join([
-        "{}: \"{}\"".format(*item)
-        for item in key_values.items()
-    ])
-
-    logger.debug(
-        "Looking for matching profile for: {}".format(log_parts)
-    )
-
-    matching_profiles = None
-    highest_profile_points = -1
-    # Each profile get 1 point for each matching filter. Profile with most
-    # points is returned. For cases when more than one profile will match
-    # are also stored ordered lists of matching values.
-    for profile in profiles_data:
-        profile_points = 0
-        profile_scores = []
-
-        for key in keys_order:
-            value = key_values[key]
-            match = validate_value_by_regexes(value, profile.get(key))
-            if match == -1:
-                profile_value = profile.get(key) or []
-                logger.debug(
-                    "\"{}\" not found in \"{}\": {}".format(value, key,
-                                                            profile_value)
-                )
-                profile_points = -1
-                break
-
-            profile_points += match
-            profile_scores.append(bool(match))
-
-        if (
-            profile_points < 0
-            or profile_points < highest_profile_points
-        ):
-            continue
-
-        if profile_points > highest_profile_points:
-            matching_profiles = []
-            highest_profile_points = profile_points
-
-        if profile_points == highest_profile_points:
-            matching_profiles.append((profile, profile_scores))
-
-    if not matching_profiles:
-        logger.debug(
-            "None of profiles match your setup. {}".format(log_parts)
-        )
-        return None
-
-    if len(matching_profiles) > 1:
-        logger.debug(
-            "More than one profile match your setup. {}".format(log_parts)
-        )
-
-    profile = _profile_exclusion(matching_profiles, logger)
-    if profile:
-        logger.debug(
-            "Profile selected: {}".format(profile)
-        )
-    return profile
+    matcher = get_profiles_matcher(profiles_data)
+    return matcher.filter(key_values, keys_order, logger)
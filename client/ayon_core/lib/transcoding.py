@@ -10,6 +10,7 @@ import platform
 import xml.etree.ElementTree
 
 from .execute import run_subprocess
+from .image_headers import read_image_header_info
 from .vendor_bin_utils import (
     get_ffmpeg_tool_args,
     get_oiio_tool_args,
@@ -78,11 +79,30 @@ def get_transcode_temp_directory():
     )
 
 
-def get_oiio_info_for_input(filepath, logger=None, subimages=False):
+def get_oiio_info_for_input(
+    filepath, logger=None, subimages=False, read_header=True
+):
     """Call oiiotool to get information about input and return stdout.
 
     Stdout should contain xml format string.
+
+    Information of EXR, DPX, TIFF and PNG files is read directly from file
+    header without spawning oiiotool. Oiiotool is used as fallback when
+    header can't be read.
+
+    Args:
+        filepath (str): Path to input file.
+        logger (Optional[logging.Logger]): Logger used for subprocess.
+        subimages (Optional[bool]): Return information of all subimages.
+        read_header (Optional[bool]): Try to read information from
+            file header before using oiiotool.
+
     """
+    if read_header:
+        output = read_image_header_info(filepath, subimages=subimages)
+        if output is not None:
+            return output
+
     args = get_oiio_tool_args(
         "oiiotool",
         "--info",
@@ -1109,6 +1129,48 @@ def convert_colorspace(
 ):
     """Convert source file from one color space to another.
 
+    See 'get_convert_colorspace_args' for arguments description.
+
+    Raises:
+        ValueError: if misconfigured
+    """
+    if logger is None:
+        logger = logging.getLogger(__name__)
+
+    oiio_cmd = get_oiio_tool_args(
+        "oiiotool",
+        *get_convert_colorspace_args(
+            input_path,
+            output_path,
+            config_path,
+            source_colorspace,
+            target_colorspace,
+            view,
+            display,
+            additional_command_args,
+            logger,
+        )
+    )
+
+    logger.debug("Conversion command: {}".format(" ".join(oiio_cmd)))
+    run_subprocess(oiio_cmd, logger=logger)
+
+
+def get_convert_colorspace_args(
+    input_path,
+    output_path,
+    config_path,
+    source_colorspace,
+    target_colorspace=None,
+    view=None,
+    display=None,
+    additional_command_args=None,
+    logger=None,
+):
+    """Oiiotool arguments to convert source file to another color space.
+
+    Returned arguments don't contain oiiotool executable.
+
     Args:
         input_path (str): Path that should be converted. It is expected that
             contains single file or image sequence of same type
@@ -1128,6 +1190,10 @@ def convert_colorspace(
         additional_command_args (list): arguments for oiiotool (like binary
             depth for .dpx)
         logger (logging.Logger): Logger used for logging.
+
+    Returns:
+        list[str]: Arguments for oiiotool.
+
     Raises:
         ValueError: if misconfigured
     """
@@ -1139,22 +1205,17 @@ def convert_colorspace(
     # Collect channels to export
     input_arg, channels_arg = get_oiio_input_and_channel_args(input_info)
 
-    # Prepare subprocess arguments
-    oiio_cmd = get_oiio_tool_args(
-        "oiiotool",
+    oiio_cmd = [
         # Don't add any additional attributes
         "--nosoftwareattrib",
-        "--colorconfig", config_path
-    )
-
-    oiio_cmd.extend([
+        "--colorconfig", config_path,
         input_arg, input_path,
         # Tell oiiotool which channels should be put to top stack
         #   (and output)
         "--ch", channels_arg,
         # Use first subimage
         "--subimage", "0"
-    ])
+    ]
 
     if all([target_colorspace, view, display]):
         raise ValueError("Colorspace and both screen and display"
@@ -1175,9 +1236,7 @@ def convert_colorspace(
         oiio_cmd.extend(["--ociodisplay", display, view])
 
     oiio_cmd.extend(["-o", output_path])
-
-    logger.debug("Conversion command: {}".format(" ".join(oiio_cmd)))
-    run_subprocess(oiio_cmd, logger=logger)
+    return oiio_cmd
 
 
 def split_cmd_args(in_args):
@@ -0,0 +1,436 @@
+"""Local service running extraction jobs out of publish process.
+
+Publish plugins can hand over heavy extraction commands (ffmpeg, oiiotool)
+to the tray webserver and continue. Each job contains steps with tool name
+and its arguments which may depend on other steps of the job. Executable of
+the tool is resolved by the service, arbitrary commands are not allowed.
+Jobs are processed on a bounded pool of worker threads by priority.
+
+Each request must contain token of the service in 'X-Ayon-Extraction-Token'
+header. The token is generated on service start and is available to
+processes launched from tray in 'AYON_EXTRACTION_JOBS_TOKEN' environment
+variable. Jobs must be submitted with 'application/json' content type.
+
+Routes:
+    POST "/extraction/jobs": Submit job. Returns job id.
+    GET "/extraction/jobs": List all jobs.
+    GET "/extraction/jobs/{job_id}": Job data with status and progress.
+    GET "/extraction/jobs/{job_id}/events": Stream of job events as json
+        lines until job is done.
+"""
+
+import os
+import json
+import uuid
+import hmac
+import secrets
+import time
+import asyncio
+import itertools
+import threading
+import queue
+
+from aiohttp import web
+
+from ayon_core.lib import (
+    Logger,
+    run_subprocess,
+    get_oiio_tool_args,
+    get_ffmpeg_tool_args,
+)
+
+from .base_routes import RestApiEndpoint
+
+EXTRACTION_JOBS_TOKEN_ENV = "AYON_EXTRACTION_JOBS_TOKEN"
+EXTRACTION_JOBS_TOKEN_HEADER = "X-Ayon-Extraction-Token"
+
+# Tools which can be used by job steps
+TOOL_ARGS_GETTERS = {
+    "oiiotool": get_oiio_tool_args,
+    "ffmpeg": get_ffmpeg_tool_args,
+}
+
+
+class ExtractionJobStatus:
+    PENDING = "pending"
+    RUNNING = "running"
+    FINISHED = "finished"
+    FAILED = "failed"
+
+    done_statuses = {FINISHED, FAILED}
+
+
+class ExtractionJob:
+    """Extraction job with command graph.
+
+    Args:
+        steps (list[dict[str, Any]]): Steps of the job. Each step must
+            contain 'tool' with name of tool from 'TOOL_ARGS_GETTERS' and
+            'args' with its arguments. Optionally can contain 'id' and
+            'depends_on' with ids of steps that must be finished before
+            the step.
+        outputs (Optional[list[str]]): Paths which must exist after all
+            steps are finished.
+        priority (Optional[int]): Jobs with lower value are processed
+            first.
+        label (Optional[str]): Job label for reports.
+
+    """
+    def __init__(self, steps, outputs=None, priority=None, label=None):
+        if priority is None:
+            priority = 50
+        self.id = uuid.uuid4().hex
+        self.label = label or self.id
+        self.priority = priority
+        self.outputs = list(outputs or [])
+        self.steps = self._sort_steps(steps)
+        self.status = ExtractionJobStatus.PENDING
+        self.error = None
+        self.created = time.time()
+        self.started = None
+        self.finished = None
+        self.finished_steps = 0
+        self._events = []
+        self._lock = threading.Lock()
+        self._add_event("status", status=self.status)
+
+    @staticmethod
+    def _sort_steps(steps):
+        """Sort steps by their dependencies.
+
+        Raises:
+            ValueError: When steps are invalid or dependencies are cyclic.
+
+        """
+        steps_by_id = {}
+        for idx, step in enumerate(steps):
+            tool = step.get("tool")
+            if tool not in TOOL_ARGS_GETTERS:
+                raise ValueError(
+                    "Step {} has unknown tool '{}'".format(idx, tool)
+                )
+            args = step.get("args")
+            if (
+                not isinstance(args, list)
+                or not all(isinstance(arg, str) for arg in args)
+            ):
+                raise ValueError(
+                    "Step {} 'args' must be list of strings".format(idx)
+                )
+            step = {
+                "id": str(step.get("id", idx)),
+                "tool": tool,
+                "args": list(args),
+                "depends_on": [
+                    str(dep) for dep in step.get("depends_on") or []
+                ],
+            }
+            steps_by_id[step["id"]] = step
+
+        sorted_steps = []
+        done_ids = set()
+        remaining = list(steps_by_id.values())
+        while remaining:
+            ready = [
+                step
+                for step in remaining
+                if all(dep in done_ids for dep in step["depends_on"])
+            ]
+            if not ready:
+                raise ValueError(
+                    "Steps have unknown or cyclic dependencies: {}".format(
+                        ", ".join(step["id"] for step in remaining)
+                    )
+                )
+            for step in ready:
+                remaining.remove(step)
+                done_ids.add(step["id"])
+                sorted_steps.append(step)
+        return sorted_steps
+
+    @property
+    def progress(self):
+        if not self.steps:
+            return 1.0
+        return float(self.finished_steps) / len(self.steps)
+
+    @property
+    def is_done(self):
+        return self.status in ExtractionJobStatus.done_statuses
+
+    def _add_event(self, event_type, **kwargs):
+        event = {
+            "type": event_type,
+            "time": time.time(),
+            "progress": self.progress,
+        }
+        event.update(kwargs)
+        with self._lock:
+            self._events.append(event)
+
+    def get_events(self, start_idx=0):
+        with self._lock:
+            return list(self._events[start_idx:])
+
+    def set_running(self):
+        self.status = ExtractionJobStatus.RUNNING
+        self.started = time.time()
+        self._add_event("status", status=self.status)
+
+    def set_step_finished(self, step):
+        self.finished_steps += 1
+        self._add_event("step", step_id=step["id"])
+
+    def set_finished(self):
+        self.status = ExtractionJobStatus.FINISHED
+        self.finished = time.time()
+        self._add_event("status", status=self.status)
+
+    def set_failed(self, error):
+        self.status = ExtractionJobStatus.FAILED
+        self.error = error
+        self.finished = time.time()
+        self._add_event("status", status=self.status, error=error)
+
+    def to_data(self):
+        return {
+            "id": self.id,
+            "label": self.label,
+            "priority": self.priority,
+            "status": self.status,
+            "progress": self.progress,
+            "error": self.error,
+            "outputs": self.outputs,
+            "created": self.created,
+            "started": self.started,
+            "finished": self.finished,
+        }
+
+
+class ExtractionJobsManager:
+    """Process extraction jobs on bounded pool of worker threads.
+
+    Manager does not depend on webserver and can be used on its own.
+
+    Args:
+        workers (Optional[int]): Number of jobs processed at the same time.
+            Default is based on cpu count.
+        logger (Optional[logging.Logger]): Logger used for output.
+
+    """
+    # Keep finished jobs in memory for this amount of seconds
+    finished_jobs_lifetime = 60 * 60
+
+    def __init__(self, workers=None, logger=None):
+        if workers is None:
+            workers = max(1, (os.cpu_count() or 1) // 4)
+        if logger is None:
+            logger = Logger.get_logger(self.__class__.__name__)
+        self.log = logger
+        self._workers_count = workers
+        self._workers = []
+        self._jobs_by_id = {}
+        self._queue = queue.PriorityQueue()
+        self._counter = itertools.count()
+        self._lock = threading.Lock()
+
+    def start(self):
+        if self._workers:
+            return
+        for idx in range(self._workers_count):
+            thread = threading.Thread(
+                target=self._worker_loop,
+                name="ExtractionJobWorker{}".format(idx),
+                daemon=True
+            )
+            thread.start()
+            self._workers.append(thread)
+
+    def stop(self):
+        for _ in self._workers:
+            self._queue.put((float("inf"), next(self._counter), None))
+        self._workers = []
+
+    def submit(self, steps, outputs=None, priority=None, label=None):
+        """Add job to queue.
+
+        Returns:
+            ExtractionJob: Created job.
+
+        Raises:
+            ValueError: When job steps are invalid.
+
+        """
+        job = ExtractionJob(steps, outputs, priority, label)
+        with self._lock:
+            self._clear_old_jobs()
+            self._jobs_by_id[job.id] = job
+        self._queue.put((job.priority, next(self._counter), job))
+        self.log.debug("Extraction job '{}' queued".format(job.label))
+        return job
+
+    def get_job(self, job_id):
+        with self._lock:
+            return self._jobs_by_id.get(job_id)
+
+    def get_jobs(self):
+        with self._lock:
+            return list(self._jobs_by_id.values())
+
+    def _clear_old_jobs(self):
+        min_time = time.time() - self.finished_jobs_lifetime
+        for job_id, job in tuple(self._jobs_by_id.items()):
+            if job.is_done and job.finished < min_time:
+                self._jobs_by_id.pop(job_id)
+
+    def _worker_loop(self):
+        while True:
+            _, _, job = self._queue.get()
+            if job is None:
+                return
+            try:
+                self._process_job(job)
+            except Exception as exc:
+                self.log.warning(
+                    "Extraction job '{}' failed".format(job.label),
+                    exc_info=True
+                )
+                job.set_failed(str(exc))
+
+    def _process_job(self, job):
+        job.set_running()
+        for step in job.steps:
+            args = TOOL_ARGS_GETTERS[step["tool"]](step["tool"], *step["args"])
+            run_subprocess(args, logger=self.log)
+            job.set_step_finished(step)
+
+        missing = [path for path in job.outputs if not os.path.exists(path)]
+        if missing:
+            job.set_failed(
+                "Missing outputs: {}".format(", ".join(missing))
+            )
+            return
+        job.set_finished()
+
+
+class _ExtractionEndpoint(RestApiEndpoint):
+    """Endpoint validating token of the service before processing."""
+
+    def __init__(self, manager, token):
+        self._manager = manager
+        self._token = token
+        super(_ExtractionEndpoint, self).__init__()
+
+    async def dispatch(self, request):
+        token = request.headers.get(EXTRACTION_JOBS_TOKEN_HEADER) or ""
+        if not hmac.compare_digest(token, self._token):
+            return web.json_response(
+                {"error": "Invalid token"}, status=401
+            )
+
+        if (
+            request.method.upper() == "POST"
+            and request.content_type != "application/json"
+        ):
+            return web.json_response(
+                {"error": "Expected 'application/json' content type"},
+                status=415
+            )
+        return await super(_ExtractionEndpoint, self).dispatch(request)
+
+
+class ExtractionJobsEndpoint(_ExtractionEndpoint):
+
+    async def get(self):
+        return web.json_response([
+            job.to_data()
+            for job in self._manager.get_jobs()
+        ])
+
+    async def post(self, request):
+        try:
+            data = await request.json()
+            job = self._manager.submit(
+                data["steps"],
+                data.get("outputs"),
+                data.get("priority"),
+                data.get("label"),
+            )
+        except (KeyError, TypeError, ValueError, AttributeError) as exc:
+            return web.json_response(
+                {"error": "Invalid job data: {}".format(exc)}, status=400
+            )
+        return web.json_response(job.to_data())
+
+
+class ExtractionJobEndpoint(_ExtractionEndpoint):
+    async def get(self, job_id):
+        job = self._manager.get_job(job_id)
+        if job is None:
+            return web.json_response(
+                {"error": "Job not found"}, status=404
+            )
+        return web.json_response(job.to_data())
+
+
+class ExtractionJobEventsEndpoint(_ExtractionEndpoint):
+    poll_interval = 0.2
+
+    async def get(self, request, job_id):
+        job = self._manager.get_job(job_id)
+        if job is None:
+            return web.json_response(
+                {"error": "Job not found"}, status=404
+            )
+
+        response = web.StreamResponse()
+        response.content_type = "application/x-ndjson"
+        await response.prepare(request)
+        event_idx = 0
+        while True:
+            is_done = job.is_done
+            events = job.get_events(event_idx)
+            event_idx += len(events)
+            for event in events:
+                line = json.dumps(event) + "\n"
+                await response.write(line.encode("utf-8"))
+            if is_done:
+                break
+            await asyncio.sleep(self.poll_interval)
+
+        await response.write_eof()
+        return response
+
+
+class ExtractionJobsService:
+    """Register extraction jobs routes to webserver manager.
+
+    Args:
+        server_manager (WebServerManager): Webserver manager.
+        workers (Optional[int]): Number of jobs processed at the same time.
+
+    """
+    prefix = "/extraction/jobs"
+
+    def __init__(self, server_manager, workers=None):
+        self.manager = ExtractionJobsManager(workers)
+        # Processes launched from tray inherit the token
+        token = secrets.token_hex(32)
+        os.environ[EXTRACTION_JOBS_TOKEN_ENV] = token
+
+        jobs_endpoint = ExtractionJobsEndpoint(self.manager, token)
+        job_endpoint = ExtractionJobEndpoint(self.manager, token)
+        events_endpoint = ExtractionJobEventsEndpoint(self.manager, token)
+        server_manager.add_route(
+            "*", self.prefix, jobs_endpoint.dispatch
+        )
+        server_manager.add_route(
+            "*", self.prefix + "/{job_id}", job_endpoint.dispatch
+        )
+        server_manager.add_route(
+            "*", self.prefix + "/{job_id}/events", events_endpoint.dispatch
+        )
+        server_manager.on_stop_callbacks.append(self.manager.stop)
+
+    def start(self):
+        self.manager.start()
@@ -1,4 +1,5 @@
 import json
+import zlib
 import logging
 from concurrent.futures import CancelledError
 
@@ -89,7 +90,9 @@ class HostListener:
         widget = None
         try:
             async for msg in ws:
-                if msg.type == aiohttp.WSMsgType.TEXT:
+                if msg.type in (
+                    aiohttp.WSMsgType.TEXT, aiohttp.WSMsgType.BINARY
+                ):
                     host_name, action, text = self._parse_message(msg)
 
                     if action == HostMsgAction.CONNECTING:
@@ -140,7 +143,11 @@ class HostListener:
         widget.deleteLater()
 
     def _parse_message(self, msg):
-        data = json.loads(msg.data)
+        msg_data = msg.data
+        # Big messages are sent zlib compressed
+        if isinstance(msg_data, bytes):
+            msg_data = zlib.decompress(msg_data).decode("utf-8")
+        data = json.loads(msg_data)
         action = data.get("action")
         host_name = data["host"]
         value = data.get("text")
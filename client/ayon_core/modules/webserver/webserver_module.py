@@ -39,6 +39,7 @@ class WebServerAddon(AYONAddon, ITrayService):
     def initialize(self, settings):
         self._server_manager = None
         self._host_listener = None
+        self._extraction_jobs_service = None
 
         self._port = self.find_free_port()
         self._webserver_url = None
@@ -95,9 +96,12 @@ class WebServerAddon(AYONAddon, ITrayService):
         self.create_server_manager()
         self._add_resources_statics()
         self._add_listeners()
+        self._add_extraction_jobs_service()
 
     def tray_start(self):
         self.start_server()
+        if self._extraction_jobs_service is not None:
+            self._extraction_jobs_service.start()
 
     def tray_exit(self):
         self.stop_server()
@@ -210,3 +214,10 @@ class WebServerAddon(AYONAddon, ITrayService):
         self._host_listener = host_console_listener.HostListener(
             self._server_manager, self
         )
+
+    def _add_extraction_jobs_service(self):
+        from .extraction_jobs import ExtractionJobsService
+
+        self._extraction_jobs_service = ExtractionJobsService(
+            self._server_manager
+        )
@@ -4,9 +4,14 @@ from .constants import (
     AYON_CONTAINER_ID,
     AYON_INSTANCE_ID,
     HOST_WORKFILE_EXTENSIONS,
+    VERSION_RESOURCE_FILES_KEY,
 )
 
-from .anatomy import Anatomy
+from .anatomy import (
+    Anatomy,
+    get_shared_anatomy,
+    clear_shared_anatomy,
+)
 
 from .create import (
     BaseCreator,
@@ -116,9 +121,12 @@ __all__ = (
     "AYON_CONTAINER_ID",
     "AYON_INSTANCE_ID",
     "HOST_WORKFILE_EXTENSIONS",
+    "VERSION_RESOURCE_FILES_KEY",
 
     # --- Anatomy ---
     "Anatomy",
+    "get_shared_anatomy",
+    "clear_shared_anatomy",
 
     # --- Create ---
     "BaseCreator",
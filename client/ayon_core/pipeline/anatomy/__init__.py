@@ -4,7 +4,11 @@ from .exceptions import (
     TemplateMissingKey,
     AnatomyTemplateUnsolved,
 )
-from .anatomy import Anatomy
+from .anatomy import (
+    Anatomy,
+    get_shared_anatomy,
+    clear_shared_anatomy,
+)
 
 
 __all__ = (
@@ -14,4 +18,6 @@ __all__ = (
     "AnatomyTemplateUnsolved",
 
     "Anatomy",
+    "get_shared_anatomy",
+    "clear_shared_anatomy",
 )
@@ -1,7 +1,11 @@
 import os
 import re
 import copy
+import json
+import time
+import hashlib
 import platform
+import threading
 import collections
 
 import ayon_api
@@ -508,3 +512,135 @@ class Anatomy(BaseAnatomy):
                 )
             site_cache.update_data(roots_overrides)
         return site_cache.get_data()
+
+
+class _SharedAnatomyItem:
+    def __init__(self, anatomy, project_state, root_overrides):
+        self.anatomy = anatomy
+        self.project_state = project_state
+        self.root_overrides = root_overrides
+        self.checked_time = time.time()
+
+
+_shared_anatomy_items = {}
+_shared_anatomy_lock = threading.Lock()
+# Seconds for which shared anatomy is used without checking for changes
+SHARED_ANATOMY_CHECK_INTERVAL = 10
+
+
+def _get_project_state(project_name):
+    """Value which changes when project anatomy changes.
+
+    Returns:
+        tuple[Union[str, None], Union[dict[str, Any], None]]: Project
+            state and project entity if it had to be queried.
+
+    """
+    project_entity = ayon_api.get_project(
+        project_name, fields={"name", "updatedAt"}
+    )
+    if project_entity and project_entity.get("updatedAt"):
+        return project_entity["updatedAt"], None
+
+    # Fallback to hash of project when server does not return 'updatedAt'
+    project_entity = ayon_api.get_project(project_name)
+    if not project_entity:
+        return None, None
+    project_hash = hashlib.sha256(json.dumps(
+        project_entity, sort_keys=True, default=str
+    ).encode("utf-8")).hexdigest()
+    return project_hash, project_entity
+
+
+def get_shared_anatomy(project_name=None, site_name=None):
+    """Anatomy shared in current process.
+
+    Anatomy is created once per project and site and is reused until
+    anatomy of the project changes on server or root overrides of the
+    site change. Changes are checked at most once per
+    'SHARED_ANATOMY_CHECK_INTERVAL' seconds using project 'updatedAt', or
+    hash of project entity if server does not provide it.
+
+    Shared anatomy must not be modified, use 'Anatomy' directly if that is
+    needed.
+
+    Args:
+        project_name (Optional[str]): Project name. Current project is used
+            if not passed.
+        site_name (Optional[str]): Site name. Active site is used if not
+            passed.
+
+    Returns:
+        Anatomy: Shared anatomy object.
+
+    """
+    if not project_name:
+        project_name = os.environ.get("AYON_PROJECT_NAME")
+
+    if not project_name:
+        raise ProjectNotSet((
+            "Implementation bug: Project name is not set. Anatomy requires"
+            " to load data for specific project."
+        ))
+
+    key = (project_name, site_name)
+    now = time.time()
+    # Lock is held only to access shared items, server is queried
+    #   without it
+    with _shared_anatomy_lock:
+        item = _shared_anatomy_items.get(key)
+    if (
+        item is not None
+        and now - item.checked_time < SHARED_ANATOMY_CHECK_INTERVAL
+    ):
+        return item.anatomy
+
+    project_state, project_entity = _get_project_state(project_name)
+    root_overrides = Anatomy._get_site_root_overrides(
+        project_name, site_name
+    )
+    if (
+        item is not None
+        and project_state is not None
+        and item.project_state == project_state
+        and item.root_overrides == root_overrides
+    ):
+        with _shared_anatomy_lock:
+            item.checked_time = now
+        return item.anatomy
+
+    if project_entity is None:
+        project_entity = ayon_api.get_project(project_name)
+    anatomy = Anatomy(
+        project_name, site_name, project_entity=project_entity
+    )
+    new_item = _SharedAnatomyItem(
+        anatomy, project_state, copy.deepcopy(root_overrides)
+    )
+    with _shared_anatomy_lock:
+        current_item = _shared_anatomy_items.get(key)
+        # Other thread may have created anatomy of same state meanwhile
+        if (
+            current_item is not None
+            and current_item is not item
+            and project_state is not None
+            and current_item.project_state == project_state
+            and current_item.root_overrides == root_overrides
+        ):
+            return current_item.anatomy
+        _shared_anatomy_items[key] = new_item
+    return anatomy
+
+
+def clear_shared_anatomy(project_name=None):
+    """Remove shared anatomy objects so they're created again.
+
+    Args:
+        project_name (Optional[str]): Clear only anatomy of project. All
+            projects are cleared if not passed.
+
+    """
+    with _shared_anatomy_lock:
+        for key in tuple(_shared_anatomy_items):
+            if project_name is None or key[0] == project_name:
+                _shared_anatomy_items.pop(key)
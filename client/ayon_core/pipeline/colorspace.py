@@ -31,6 +31,7 @@ class CachedData:
     has_compatible_ocio_package = None
     config_version_data = {}
     ocio_config_colorspaces = {}
+    colorspace_name_matchers = {}
     allowed_exts = {
         ext.lstrip(".") for ext in IMAGE_EXTENSIONS.union(VIDEO_EXTENSIONS)
     }
@@ -328,6 +329,155 @@ def get_config_version_data(config_path):
     return deepcopy(CachedData.config_version_data[config_path])
 
 
+class ColorspaceNameMatcher:
+    """Find colorspace names in file paths.
+
+    Names are compiled to one regex shaped as a trie of names, so matching
+    is done in one pass over the path. The leftmost match in path is used
+    and the longest name wins at the same position, e.g. 'Output - sRGB'
+    is matched over 'sRGB'. Spaces in names can be also matched as
+    underscores because the integrator replaces spaces with underscores
+    in filenames.
+
+    Args:
+        colorspaces (Iterable[str]): Colorspace names.
+
+    """
+    def __init__(self, colorspaces):
+        self.colorspaces = frozenset(colorspaces)
+        names_mapping = {
+            colorspace.replace(" ", "_"): colorspace
+            for colorspace in self.colorspaces
+            if " " in colorspace
+        }
+        names_mapping.update({
+            colorspace: colorspace
+            for colorspace in self.colorspaces
+        })
+        self._names_mapping = names_mapping
+        self._regex = self._compile_regex(names_mapping.keys())
+
+    @staticmethod
+    def _compile_regex(names):
+        trie = {}
+        for name in names:
+            if not name:
+                continue
+            node = trie
+            for char in name:
+                node = node.setdefault(char, {})
+            node[""] = True
+
+        def _node_to_pattern(node):
+            is_end = "" in node
+            children = [
+                re.escape(char) + _node_to_pattern(child)
+                for char, child in sorted(node.items())
+                if char
+            ]
+            if not children:
+                return ""
+            if len(children) == 1:
+                pattern = children[0]
+                if is_end:
+                    return "(?:{})?".format(pattern)
+                return pattern
+
+            pattern = "(?:{})".format("|".join(children))
+            if is_end:
+                # Greedy optional prefers longer names
+                pattern += "?"
+            return pattern
+
+        if not trie:
+            return None
+        return re.compile(_node_to_pattern(trie))
+
+    def match(self, filepath):
+        """Colorspace name used in path.
+
+        Args:
+            filepath (str): Path to file.
+
+        Returns:
+            Union[str, None]: Colorspace name.
+
+        """
+        if self._regex is None:
+            return None
+        match = self._regex.search(filepath)
+        if match is None:
+            return None
+        return self._names_mapping[match.group(0)]
+
+    def match_many(self, filepaths):
+        """Colorspace names used in paths.
+
+        Args:
+            filepaths (Iterable[str]): Paths to files.
+
+        Returns:
+            dict[str, Union[str, None]]: Colorspace name by path.
+
+        """
+        return {
+            filepath: self.match(filepath)
+            for filepath in filepaths
+        }
+
+
+def _get_config_mtime(config_path):
+    try:
+        return os.path.getmtime(config_path)
+    except OSError:
+        return None
+
+
+def get_colorspace_name_matcher(colorspaces=None, config_path=None):
+    """Cached matcher of colorspace names.
+
+    Matcher for config is cached by config path and modification time,
+    matcher for passed colorspaces is cached by the names.
+
+    Args:
+        colorspaces (Optional[Iterable[str]]): Colorspace names.
+        config_path (Optional[str]): Path to config.ocio file, used if
+            colorspaces are not passed.
+
+    Returns:
+        ColorspaceNameMatcher: Matcher of colorspace names.
+
+    """
+    if not colorspaces and not config_path:
+        raise ValueError(
+            "Must provide `config_path` if `colorspaces` is not provided."
+        )
+
+    matchers = CachedData.colorspace_name_matchers
+    if colorspaces:
+        key = ("colorspaces", frozenset(colorspaces))
+        matcher = matchers.get(key)
+        if matcher is None:
+            matcher = ColorspaceNameMatcher(key[1])
+            matchers[key] = matcher
+        return matcher
+
+    mtime = _get_config_mtime(config_path)
+    key = ("config", config_path)
+    cached = matchers.get(key)
+    if cached is not None and cached[0] == mtime:
+        return cached[1]
+
+    if cached is not None:
+        # Config file changed, make sure colorspaces are read again
+        CachedData.ocio_config_colorspaces.pop(config_path, None)
+    matcher = ColorspaceNameMatcher(
+        get_ocio_config_colorspaces(config_path)["colorspaces"]
+    )
+    matchers[key] = (mtime, matcher)
+    return matcher
+
+
 def parse_colorspace_from_filepath(
     filepath, colorspaces=None, config_path=None
 ):
@@ -354,50 +504,8 @@ def parse_colorspace_from_filepath(
     Returns:
         str: name of colorspace
     """
-    def _get_colorspace_match_regex(colorspaces):
-        """Return a regex pattern
-
-        Allows to search a colorspace match in a filename
-
-        Args:
-            colorspaces (list): List of colorspace names
-
-        Returns:
-            re.Pattern: regex pattern
-        """
-        pattern = "|".join(
-            # Allow to match spaces also as underscores because the
-            # integrator replaces spaces with underscores in filenames
-            re.escape(colorspace)
-            # Sort by longest first so the regex matches longer matches
-            # over smaller matches, e.g. matching 'Output - sRGB' over 'sRGB'
-            for colorspace in sorted(colorspaces, key=len, reverse=True)
-        )
-        return re.compile(pattern)
-
-    if not colorspaces and not config_path:
-        raise ValueError(
-            "Must provide `config_path` if `colorspaces` is not provided."
-        )
-
-    colorspaces = (
-        colorspaces
-        or get_ocio_config_colorspaces(config_path)["colorspaces"]
-    )
-    underscored_colorspaces = {
-        key.replace(" ", "_"): key for key in colorspaces
-        if " " in key
-    }
-
-    # match colorspace from  filepath
-    regex_pattern = _get_colorspace_match_regex(
-        list(colorspaces) + list(underscored_colorspaces))
-    match = regex_pattern.search(filepath)
-    colorspace = match.group(0) if match else None
-
-    if colorspace in underscored_colorspaces:
-        return underscored_colorspaces[colorspace]
-
+    matcher = get_colorspace_name_matcher(colorspaces, config_path)
+    colorspace = matcher.match(filepath)
     if colorspace:
         return colorspace
 
@@ -407,6 +515,27 @@ def parse_colorspace_from_filepath(
     return None
 
 
+def parse_colorspaces_from_filepaths(
+    filepaths, colorspaces=None, config_path=None
+):
+    """Parse colorspace names from multiple filepaths.
+
+    Same as 'parse_colorspace_from_filepath' but the matcher is resolved
+    only once for all paths.
+
+    Args:
+        filepaths (Iterable[str]): Paths to files.
+        colorspaces (Optional[dict[str]]): list of colorspaces
+        config_path (Optional[str]): path to config.ocio file
+
+    Returns:
+        dict[str, Union[str, None]]: Colorspace name by path.
+
+    """
+    matcher = get_colorspace_name_matcher(colorspaces, config_path)
+    return matcher.match_many(filepaths)
+
+
 def validate_imageio_colorspace_in_config(config_path, colorspace_name):
     """Validator making sure colorspace name is used in config.ocio
 
@@ -421,8 +550,8 @@ def validate_imageio_colorspace_in_config(config_path, colorspace_name):
         bool: True if exists
 
     """
-    colorspaces = get_ocio_config_colorspaces(config_path)["colorspaces"]
-    if colorspace_name not in colorspaces:
+    matcher = get_colorspace_name_matcher(config_path=config_path)
+    if colorspace_name not in matcher.colorspaces:
         raise KeyError(
             "Missing colorspace '{}' in config file '{}'".format(
                 colorspace_name, config_path)
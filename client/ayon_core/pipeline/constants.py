@@ -5,6 +5,10 @@ AYON_INSTANCE_ID = "ayon.create.instance"
 AVALON_CONTAINER_ID = "pyblish.avalon.container"
 AVALON_INSTANCE_ID = "pyblish.avalon.instance"
 
+# Key in version data where version resource files are stored once instead
+#   of being added to 'files' of each representation
+VERSION_RESOURCE_FILES_KEY = "resourceFiles"
+
 # TODO get extensions from host implementations
 HOST_WORKFILE_EXTENSIONS = {
     "blender": [".blend"],
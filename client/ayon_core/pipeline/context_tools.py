@@ -21,7 +21,7 @@ from ayon_core.addon import load_addons, AddonsManager
 from ayon_core.settings import get_project_settings
 
 from .publish.lib import filter_pyblish_plugins
-from .anatomy import Anatomy
+from .anatomy import get_shared_anatomy
 from .template_data import get_template_data_with_names
 from .workfile import (
     get_workdir,
@@ -207,7 +207,7 @@ def install_ayon_plugins(project_name=None, host_name=None):
 
     # Register studio specific plugins
     if project_name:
-        anatomy = Anatomy(project_name)
+        anatomy = get_shared_anatomy(project_name)
         anatomy.set_root_environments()
         register_root(anatomy.roots)
 
@@ -607,7 +607,7 @@ def version_up_current_workfile():
         task_name,
         host_name,
     )
-    anatomy = Anatomy(project_name)
+    anatomy = get_shared_anatomy(project_name)
 
     data = get_template_data_with_names(
         project_name, folder_path, task_name, host_name
@@ -41,6 +41,12 @@ from .context import (
     CreateContext
 )
 
+from .remote_sync import (
+    RemoteSyncSequenceError,
+    CreateContextSyncSender,
+    CreateContextSyncReceiver,
+)
+
 from .legacy_create import (
     LegacyCreator,
     legacy_create,
@@ -81,6 +87,10 @@ __all__ = (
     "CreatedInstance",
     "CreateContext",
 
+    "RemoteSyncSequenceError",
+    "CreateContextSyncSender",
+    "CreateContextSyncReceiver",
+
     "LegacyCreator",
     "legacy_create",
 )
@@ -15,6 +15,7 @@ import ayon_api
 from ayon_core.settings import get_project_settings
 from ayon_core.lib.attribute_definitions import (
     UnknownDef,
+    intern_attr_def,
     serialize_attr_defs,
     deserialize_attr_defs,
     get_default_values,
@@ -572,7 +573,10 @@ class AttributeValues(object):
     def __getitem__(self, key):
         if key not in self._attr_defs_by_key:
             return self._data[key]
-        return self._data.get(key, self._attr_defs_by_key[key].default)
+        if key in self._data:
+            return self._data[key]
+        # Attribute definitions are shared, default must not be modified
+        return copy.deepcopy(self._attr_defs_by_key[key].default)
 
     def __contains__(self, key):
         return key in self._attr_defs_by_key
@@ -640,7 +644,7 @@ class AttributeValues(object):
 
         for key, attr_def in self._attr_defs_by_key.items():
             if key not in output:
-                output[key] = attr_def.default
+                output[key] = copy.deepcopy(attr_def.default)
         return output
 
     def get_serialized_attr_defs(self):
@@ -792,6 +796,11 @@ class PublishAttributes:
             attr_defs = plugin.get_attribute_defs()
             if not attr_defs:
                 continue
+            # Same definitions of many instances share read-only objects
+            attr_defs = [
+                intern_attr_def(attr_def)
+                for attr_def in attr_defs
+            ]
 
             key = plugin.__name__
             added_keys.add(key)
@@ -824,22 +833,22 @@ class PublishAttributes:
         self._plugin_names_order = data["plugin_names_order"]
         self._missing_plugins = data["missing_plugins"]
 
-        attr_defs = deserialize_attr_defs(data["attr_defs"])
-
         origin_data = self._origin_data
-        data = self._data
+        values = self._data
         self._data = {}
 
         added_keys = set()
-        for plugin_name, attr_defs_data in attr_defs.items():
-            attr_defs = deserialize_attr_defs(attr_defs_data)
-            value = data.get(plugin_name) or {}
+        for plugin_name, attr_defs_data in data["attr_defs"].items():
+            # Same definitions of many instances share read-only objects
+            attr_defs = deserialize_attr_defs(attr_defs_data, intern=True)
+            added_keys.add(plugin_name)
+            value = values.get(plugin_name) or {}
             orig_value = copy.deepcopy(origin_data.get(plugin_name) or {})
             self._data[plugin_name] = PublishAttributeValues(
                 self, attr_defs, value, orig_value
             )
 
-        for key, value in data.items():
+        for key, value in values.items():
             if key not in added_keys:
                 self._missing_plugins.append(key)
                 self._data[key] = PublishAttributeValues(
@@ -960,9 +969,14 @@ class CreatedInstance:
         # {key: value}
         creator_values = copy.deepcopy(orig_creator_attributes)
 
+        # Same definitions of many instances share read-only objects, so
+        #   they're serialized only once
         self._data["creator_attributes"] = CreatorAttributeValues(
             self,
-            list(creator_attr_defs),
+            [
+                intern_attr_def(attr_def)
+                for attr_def in creator_attr_defs
+            ],
             creator_values,
             orig_creator_attributes
         )
@@ -1260,7 +1274,7 @@ class CreatedInstance:
         creator_label = serialized_data["creator_label"]
         group_label = serialized_data["group_label"]
         creator_attr_defs = deserialize_attr_defs(
-            serialized_data["creator_attr_defs"]
+            serialized_data["creator_attr_defs"], intern=True
         )
         publish_attributes = serialized_data["publish_attributes"]
 
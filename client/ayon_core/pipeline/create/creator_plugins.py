@@ -10,6 +10,7 @@ from ayon_core.settings import get_project_settings
 from ayon_core.lib import Logger
 from ayon_core.pipeline.plugin_discover import (
     discover,
+    create_plugin_subclass,
     register_plugin,
     register_plugin_path,
     deregister_plugin,
@@ -820,7 +821,11 @@ def discover_legacy_creator_plugins():
 
     log = Logger.get_logger("CreatorDiscover")
 
-    plugins = discover(LegacyCreator)
+    # Settings are applied to subclasses, discovered classes are shared
+    plugins = [
+        create_plugin_subclass(plugin)
+        for plugin in discover(LegacyCreator)
+    ]
     project_name = get_current_project_name()
     project_settings = get_project_settings(project_name)
     for plugin in plugins:
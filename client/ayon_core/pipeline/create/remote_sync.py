@@ -0,0 +1,310 @@
+"""Synchronization of create context instances with remote process.
+
+Hosts running publisher UI in other process send serialized instances
+(see 'CreatedInstance.serialize_for_remote') over their connection. Sending
+all instances with all attribute definitions on every change does scale
+with scene size, so sender sends full state only once and then only
+changes since last message.
+
+Each message has 'sequence' number. Delta message has 'base_sequence'
+which must match sequence of last message applied by receiver, otherwise
+receiver raises 'RemoteSyncSequenceError' and full state should be
+requested from sender.
+
+Full message:
+    {
+        "sequence": 1,
+        "base_sequence": None,
+        "full": True,
+        "instances": {<instance id>: <serialized instance>},
+        "order": [<instance id>, ...]
+    }
+
+Delta message:
+    {
+        "sequence": 2,
+        "base_sequence": 1,
+        "full": False,
+        "added": {<instance id>: <serialized instance>},
+        "changed": {<instance id>: <instance changes>},
+        "removed": [<instance id>, ...],
+        "order": None | [<instance id>, ...]
+    }
+
+Instance changes contain only changed keys of serialized instance. Values
+under 'data' and 'orig_data' are sent as changed keys ('set') and removed
+keys ('removed'), other keys, e.g. attribute definitions, are sent whole.
+"""
+
+import copy
+
+from .context import CreatedInstance
+
+DICT_DIFF_KEYS = ("data", "orig_data")
+
+
+class RemoteSyncSequenceError(Exception):
+    """Delta message can't be applied to current state of receiver."""
+
+
+def _diff_dicts(old_data, new_data):
+    changed = {
+        key: value
+        for key, value in new_data.items()
+        if key not in old_data or old_data[key] != value
+    }
+    removed = [key for key in old_data if key not in new_data]
+    if not changed and not removed:
+        return None
+    return {"set": changed, "removed": removed}
+
+
+def _diff_serialized_instance(old_data, new_data):
+    changes = {}
+    for key, value in new_data.items():
+        old_value = old_data.get(key)
+        if key in DICT_DIFF_KEYS and isinstance(old_value, dict):
+            diff = _diff_dicts(old_value, value)
+            if diff is not None:
+                changes[key] = diff
+        elif old_value != value:
+            changes[key] = {"value": value}
+    return changes
+
+
+def _apply_serialized_instance_changes(serialized, changes):
+    for key, change in changes.items():
+        if "value" in change:
+            serialized[key] = change["value"]
+            continue
+
+        value = serialized.setdefault(key, {})
+        for removed_key in change["removed"]:
+            value.pop(removed_key, None)
+        value.update(change["set"])
+
+
+class CreateContextSyncSender:
+    """Prepare messages with changes of create context instances.
+
+    Sender keeps copy of last sent state, so message contains only
+    instances and values that changed since the last message.
+
+    Args:
+        create_context (CreateContext): Context with instances.
+
+    """
+    def __init__(self, create_context):
+        self._create_context = create_context
+        self._sequence = 0
+        self._serialized_by_id = None
+        self._order = None
+
+    @property
+    def sequence(self):
+        """Sequence number of last prepared message."""
+        return self._sequence
+
+    def reset(self):
+        """Next message will contain full state."""
+        self._serialized_by_id = None
+        self._order = None
+
+    def get_full_state(self):
+        """Message with all instances.
+
+        Returns:
+            dict[str, Any]: Full state message.
+
+        """
+        serialized_by_id, order = self._serialize_instances()
+        self._sequence += 1
+        self._serialized_by_id = serialized_by_id
+        self._order = order
+        return {
+            "sequence": self._sequence,
+            "base_sequence": None,
+            "full": True,
+            "instances": copy.deepcopy(serialized_by_id),
+            "order": list(order),
+        }
+
+    def get_changes(self):
+        """Message with changes since last message.
+
+        Full state is returned if nothing was sent yet.
+
+        Returns:
+            Union[dict[str, Any], None]: Delta message or None if nothing
+                changed.
+
+        """
+        if self._serialized_by_id is None:
+            return self.get_full_state()
+
+        serialized_by_id, order = self._serialize_instances()
+        prev_serialized_by_id = self._serialized_by_id
+
+        added = {}
+        changed = {}
+        for instance_id, serialized in serialized_by_id.items():
+            prev_serialized = prev_serialized_by_id.get(instance_id)
+            if prev_serialized is None:
+                added[instance_id] = copy.deepcopy(serialized)
+                continue
+            changes = _diff_serialized_instance(prev_serialized, serialized)
+            if changes:
+                changed[instance_id] = copy.deepcopy(changes)
+
+        removed = [
+            instance_id
+            for instance_id in prev_serialized_by_id
+            if instance_id not in serialized_by_id
+        ]
+        order_changed = order != self._order
+        if not added and not changed and not removed and not order_changed:
+            return None
+
+        base_sequence = self._sequence
+        self._sequence += 1
+        self._serialized_by_id = serialized_by_id
+        self._order = order
+        return {
+            "sequence": self._sequence,
+            "base_sequence": base_sequence,
+            "full": False,
+            "added": added,
+            "changed": changed,
+            "removed": removed,
+            "order": list(order) if order_changed else None,
+        }
+
+    def _serialize_instances(self):
+        serialized_by_id = {}
+        order = []
+        for instance in self._create_context.instances:
+            # Copy to not be affected by in-place changes of instance data
+            serialized_by_id[instance.id] = copy.deepcopy(
+                instance.serialize_for_remote()
+            )
+            order.append(instance.id)
+        return serialized_by_id, order
+
+
+class CreateContextSyncReceiver:
+    """Apply messages from 'CreateContextSyncSender' in remote process.
+
+    Instances are recreated only when they were added or changed.
+    """
+    def __init__(self):
+        self._sequence = None
+        self._serialized_by_id = {}
+        self._instances_by_id = {}
+        self._order = []
+
+    @property
+    def sequence(self):
+        """Sequence number of last applied message."""
+        return self._sequence
+
+    @property
+    def instances(self):
+        """Instances in order of create context.
+
+        Returns:
+            list[CreatedInstance]: Remote instances.
+
+        """
+        return [
+            self._instances_by_id[instance_id]
+            for instance_id in self._order
+        ]
+
+    @property
+    def instances_by_id(self):
+        return self._instances_by_id
+
+    def get_instance_by_id(self, instance_id):
+        return self._instances_by_id.get(instance_id)
+
+    def apply(self, message):
+        """Apply message to current state.
+
+        Args:
+            message (dict[str, Any]): Full or delta message.
+
+        Returns:
+            tuple[set[str], set[str]]: Ids of added or changed instances and
+                ids of removed instances.
+
+        Raises:
+            RemoteSyncSequenceError: Delta message does not follow last
+                applied message.
+
+        """
+        if message["full"]:
+            return self._apply_full(message)
+
+        if message["base_sequence"] != self._sequence:
+            raise RemoteSyncSequenceError(
+                "Can't apply changes {} based on {} to state {}.".format(
+                    message["sequence"],
+                    message["base_sequence"],
+                    self._sequence,
+                )
+            )
+
+        updated_ids = set()
+        for instance_id, serialized in message["added"].items():
+            self._serialized_by_id[instance_id] = serialized
+            updated_ids.add(instance_id)
+
+        for instance_id, changes in message["changed"].items():
+            serialized = self._serialized_by_id.get(instance_id)
+            if serialized is None:
+                raise RemoteSyncSequenceError(
+                    "Changed instance '{}' is not known.".format(instance_id)
+                )
+            _apply_serialized_instance_changes(serialized, changes)
+            updated_ids.add(instance_id)
+
+        removed_ids = set()
+        for instance_id in message["removed"]:
+            self._serialized_by_id.pop(instance_id, None)
+            self._instances_by_id.pop(instance_id, None)
+            removed_ids.add(instance_id)
+
+        for instance_id in updated_ids:
+            self._instances_by_id[instance_id] = (
+                CreatedInstance.deserialize_on_remote(
+                    self._serialized_by_id[instance_id]
+                )
+            )
+
+        if message["order"] is not None:
+            self._order = list(message["order"])
+        else:
+            self._order = [
+                instance_id
+                for instance_id in self._order
+                if instance_id not in removed_ids
+            ]
+            self._order.extend(message["added"].keys())
+
+        self._sequence = message["sequence"]
+        return updated_ids, removed_ids
+
+    def _apply_full(self, message):
+        removed_ids = {
+            instance_id
+            for instance_id in self._serialized_by_id
+            if instance_id not in message["instances"]
+        }
+        self._serialized_by_id = dict(message["instances"])
+        self._instances_by_id = {
+            instance_id: CreatedInstance.deserialize_on_remote(serialized)
+            for instance_id, serialized in self._serialized_by_id.items()
+        }
+        self._order = list(message["order"])
+        self._sequence = message["sequence"]
+        return set(self._serialized_by_id), removed_ids
@@ -1,5 +1,97 @@
 # -*- coding: utf-8 -*-
 import re
+import threading
+
+
+class AOVPatternMatcher:
+    """Compiled AOV patterns of one host.
+
+    Patterns are matched from start of file name same as 're.match'.
+    Patterns without groups are joined into one regex, so file name is
+    matched only once.
+
+    Args:
+        patterns (Iterable[str]): AOV regex patterns.
+
+    """
+    def __init__(self, patterns):
+        patterns = tuple(patterns)
+        self.patterns = patterns
+        regexes = [re.compile(pattern) for pattern in patterns]
+        # Joining would change numbers of groups used by backreferences
+        #   and inline flags would be applied to all patterns
+        if len(regexes) > 1 and all(
+            not regex.groups and regex.flags == re.UNICODE
+            for regex in regexes
+        ):
+            regexes = [re.compile("|".join(
+                "(?:{})".format(pattern) for pattern in patterns
+            ))]
+        self._regexes = regexes
+
+    def match(self, render_file_name):
+        """File name matches any pattern.
+
+        Args:
+            render_file_name (str): File name to match against.
+
+        Returns:
+            bool: Review state for rendered file.
+
+        """
+        return any(
+            regex.match(render_file_name) is not None
+            for regex in self._regexes
+        )
+
+    def split(self, render_file_names):
+        """Split file names to preview and non-preview.
+
+        Args:
+            render_file_names (Iterable[str]): File names to match against.
+
+        Returns:
+            tuple[list[str], list[str]]: Matching and not matching file
+                names in original order.
+
+        """
+        preview = []
+        non_preview = []
+        for render_file_name in render_file_names:
+            if self.match(render_file_name):
+                preview.append(render_file_name)
+            else:
+                non_preview.append(render_file_name)
+        return preview, non_preview
+
+
+_matchers_by_patterns = {}
+_matchers_lock = threading.Lock()
+
+
+def get_aov_pattern_matcher(host_name, aov_patterns):
+    """Compiled matcher of host AOV patterns.
+
+    Matchers are cached by patterns, settings don't change during publish
+    so patterns are compiled only once.
+
+    Args:
+        host_name (str): Host name.
+        aov_patterns (dict): AOV patterns from AOV filters.
+
+    Returns:
+        AOVPatternMatcher: Matcher of host patterns.
+
+    """
+    key = tuple(aov_patterns.get(host_name) or [])
+    matcher = _matchers_by_patterns.get(key)
+    if matcher is None:
+        with _matchers_lock:
+            matcher = _matchers_by_patterns.get(key)
+            if matcher is None:
+                matcher = AOVPatternMatcher(key)
+                _matchers_by_patterns[key] = matcher
+    return matcher
 
 
 def match_aov_pattern(host_name, aov_patterns, render_file_name):
@@ -18,7 +110,6 @@ def match_aov_pattern(host_name, aov_patterns, render_file_name):
     Returns:
         bool: Review state for rendered file (render_file_name).
     """
-    aov_pattern = aov_patterns.get(host_name, [])
-    if not aov_pattern:
-        return False
-    return any(re.match(p, render_file_name) for p in aov_pattern)
+    return get_aov_pattern_matcher(host_name, aov_patterns).match(
+        render_file_name
+    )
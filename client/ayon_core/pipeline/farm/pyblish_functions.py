@@ -14,7 +14,7 @@ from ayon_core.pipeline import (
 )
 from ayon_core.lib import Logger
 from ayon_core.pipeline.publish import KnownPublishError
-from ayon_core.pipeline.farm.patterning import match_aov_pattern
+from ayon_core.pipeline.farm.patterning import get_aov_pattern_matcher
 
 
 @attr.s
@@ -321,7 +321,9 @@ def prepare_representations(skeleton_data, exp_files, anatomy, aov_filter,
     """
     representations = []
     host_name = os.environ.get("AYON_HOST_NAME", "")
+    aov_matcher = get_aov_pattern_matcher(host_name, aov_filter)
     collections, remainders = clique.assemble(exp_files)
+    path_resolver = _RootlessPathResolver(anatomy)
 
     log = Logger.get_logger("farm_publishing")
 
@@ -345,13 +347,11 @@ def prepare_representations(skeleton_data, exp_files, anatomy, aov_filter,
                 render_file_name = list(collection)[0]
                 # if filtered aov name is found in filename, toggle it for
                 # preview video rendering
-                preview = match_aov_pattern(
-                    host_name, aov_filter, render_file_name
-                )
+                preview = aov_matcher.match(render_file_name)
 
         staging = os.path.dirname(list(collection)[0])
         success, rootless_staging_dir = (
-            anatomy.find_root_template_from_path(staging)
+            path_resolver.find_root_template(staging)
         )
         if success:
             staging = rootless_staging_dir
@@ -403,7 +403,7 @@ def prepare_representations(skeleton_data, exp_files, anatomy, aov_filter,
 
         staging = os.path.dirname(remainder)
         success, rootless_staging_dir = (
-            anatomy.find_root_template_from_path(staging)
+            path_resolver.find_root_template(staging)
         )
         if success:
             staging = rootless_staging_dir
@@ -420,9 +420,7 @@ def prepare_representations(skeleton_data, exp_files, anatomy, aov_filter,
             "stagingDir": staging,
         }
 
-        preview = match_aov_pattern(
-            host_name, aov_filter, remainder
-        )
+        preview = aov_matcher.match(remainder)
         preview = preview and not do_not_add_review
         if preview:
             rep.update({
@@ -515,6 +513,78 @@ def create_instances_for_aov(instance, skeleton, aov_filter,
     )
 
 
+class _RootlessPathResolver:
+    """Find rootless paths with cached results per directory.
+
+    Expected files of renders are usually in few directories, so root
+    does not have to be looked up for each of them.
+
+    Args:
+        anatomy (Anatomy): Anatomy object to handle remapping.
+
+    """
+    def __init__(self, anatomy):
+        self._anatomy = anatomy
+        self._cache = {}
+
+    def find_root_template(self, path):
+        """Same as 'Anatomy.find_root_template_from_path'.
+
+        Returns:
+            tuple[bool, str]: Root was found and rootless path.
+
+        """
+        result = self._cache.get(path)
+        if result is None:
+            result = self._anatomy.find_root_template_from_path(path)
+            self._cache[path] = result
+        return result
+
+    def remap(self, path):
+        """Same as 'remap_source'.
+
+        Raises:
+            ValueError: If the root cannot be found.
+
+        """
+        success, rootless_path = self.find_root_template(path)
+        if not success:
+            raise ValueError(
+                "Root from template path cannot be found: {}".format(path))
+        return rootless_path
+
+
+def _get_aov_files(files):
+    """Files of one AOV as one sequence or single file.
+
+    Returns:
+        tuple[Union[list[str], str], str]: Sequence files or single file
+            and extension.
+
+    Raises:
+        ValueError: Files are not one sequence or one file.
+
+    """
+    cols, rem = clique.assemble(files)
+    # we shouldn't have any reminders. And if we do, it should
+    # be just one item for single frame renders.
+    if not cols and rem:
+        if len(rem) != 1:
+            raise ValueError("Found multiple non related files "
+                             "to render, don't know what to do "
+                             "with them.")
+        col = rem[0]
+        ext = os.path.splitext(col)[1].lstrip(".")
+    else:
+        # but we really expect only one collection.
+        # Nothing else make sense.
+        if len(cols) != 1:
+            raise ValueError("Only one image sequence type is expected.")  # noqa: E501
+        ext = cols[0].tail.lstrip(".")
+        col = list(cols[0])
+    return col, ext
+
+
 def _create_instances_for_aov(instance, skeleton, aov_filter, additional_data,
                               skip_integration_repre_list, do_not_add_review):
     """Create instance for each AOV found.
@@ -522,6 +592,10 @@ def _create_instances_for_aov(instance, skeleton, aov_filter, additional_data,
     This will create new instance for every AOV it can detect in expected
     files list.
 
+    Data which are same for all AOVs are prepared once. New instances
+    share skeleton data (shallow copy), only keys modified per AOV are
+    copied.
+
     Args:
         instance (pyblish.api.Instance): Original instance.
         skeleton (dict): Skeleton data for instance (those needed) later
@@ -543,45 +617,45 @@ def _create_instances_for_aov(instance, skeleton, aov_filter, additional_data,
     task = os.environ["AYON_TASK_NAME"]
 
     anatomy = instance.context.data["anatomy"]
+    path_resolver = _RootlessPathResolver(anatomy)
     s_product_name = skeleton["productName"]
     cameras = instance.data.get("cameras", [])
     exp_files = instance.data["expectedFiles"]
     log = Logger.get_logger("farm_publishing")
+    app = os.environ.get("AYON_HOST_NAME", "")
+    aov_matcher = get_aov_pattern_matcher(app, aov_filter)
+    renderer = instance.data.get("renderer")
+    multipart_exr = instance.data.get("multipartExr")
+    convert_to_scanline = instance.data.get("convertToScanline")
+
+    # create product name `<product type><Task><Product name>`
+    # TODO refactor/remove me
+    product_type = skeleton["productType"]
+    if not s_product_name.startswith(product_type):
+        group_name = '{}{}{}{}{}'.format(
+            product_type,
+            task[0].upper(), task[1:],
+            s_product_name[0].upper(), s_product_name[1:])
+    else:
+        group_name = s_product_name
+
+    # Render product "colorspace" data by AOV, first product wins
+    colorspace_by_aov = {}
+    products = additional_data["renderProducts"].layer_data.products
+    for product in products:
+        colorspace_by_aov.setdefault(product.productName, product.colorspace)
+
+    frame_start = int(skeleton["frameStartHandle"])
+    frame_end = int(skeleton["frameEndHandle"])
 
     instances = []
     # go through AOVs in expected files
     for aov, files in exp_files[0].items():
-        cols, rem = clique.assemble(files)
-        # we shouldn't have any reminders. And if we do, it should
-        # be just one item for single frame renders.
-        if not cols and rem:
-            if len(rem) != 1:
-                raise ValueError("Found multiple non related files "
-                                 "to render, don't know what to do "
-                                 "with them.")
-            col = rem[0]
-            ext = os.path.splitext(col)[1].lstrip(".")
-        else:
-            # but we really expect only one collection.
-            # Nothing else make sense.
-            if len(cols) != 1:
-                raise ValueError("Only one image sequence type is expected.")  # noqa: E501
-            ext = cols[0].tail.lstrip(".")
-            col = list(cols[0])
-
-        # create product name `<product type><Task><Product name>`
-        # TODO refactor/remove me
-        product_type = skeleton["productType"]
-        if not s_product_name.startswith(product_type):
-            group_name = '{}{}{}{}{}'.format(
-                product_type,
-                task[0].upper(), task[1:],
-                s_product_name[0].upper(), s_product_name[1:])
-        else:
-            group_name = s_product_name
+        col, ext = _get_aov_files(files)
+        is_sequence = isinstance(col, (list, tuple))
+        expected_filepath = col[0] if is_sequence else col
 
         # if there are multiple cameras, we need to add camera name
-        expected_filepath = col[0] if isinstance(col, (list, tuple)) else col
         cams = [cam for cam in cameras if cam in expected_filepath]
         if cams:
             for cam in cams:
@@ -597,29 +671,19 @@ def _create_instances_for_aov(instance, skeleton, aov_filter, additional_data,
             else:
                 product_name = '{}'.format(group_name)
 
-        if isinstance(col, (list, tuple)):
-            staging = os.path.dirname(col[0])
-        else:
-            staging = os.path.dirname(col)
-
+        staging = os.path.dirname(expected_filepath)
         try:
-            staging = remap_source(staging, anatomy)
+            staging = path_resolver.remap(staging)
         except ValueError as e:
             log.warning(e)
 
         log.info("Creating data for: {}".format(product_name))
 
-        app = os.environ.get("AYON_HOST_NAME", "")
+        render_file_name = os.path.basename(expected_filepath)
+        preview = aov_matcher.match(render_file_name)
 
-        if isinstance(col, list):
-            render_file_name = os.path.basename(col[0])
-        else:
-            render_file_name = os.path.basename(col)
-        aov_patterns = aov_filter
-
-        preview = match_aov_pattern(app, aov_patterns, render_file_name)
-
-        new_instance = deepcopy(skeleton)
+        new_instance = copy.copy(skeleton)
+        new_instance["families"] = list(skeleton["families"])
         new_instance["productName"] = product_name
         new_instance["productGroup"] = group_name
 
@@ -631,16 +695,16 @@ def _create_instances_for_aov(instance, skeleton, aov_filter, additional_data,
         # files even when the rest of the AOVs are merged into a single EXR.
         # There might be an edge case where the main instance has cryptomatte
         # in the name even though it's a multipart EXR.
-        if instance.data.get("renderer") == "redshift":
+        if renderer == "redshift":
             if (
-                instance.data.get("multipartExr") and
+                multipart_exr and
                 "cryptomatte" not in render_file_name.lower()
             ):
                 log.debug("Adding preview tag because it's multipartExr")
                 preview = True
             else:
                 new_instance["multipartExr"] = False
-        elif instance.data.get("multipartExr"):
+        elif multipart_exr:
             log.debug("Adding preview tag because its multipartExr")
             preview = True
 
@@ -650,31 +714,24 @@ def _create_instances_for_aov(instance, skeleton, aov_filter, additional_data,
             new_instance["review"] = True
 
         # create representation
-        if isinstance(col, (list, tuple)):
+        if is_sequence:
             files = [os.path.basename(f) for f in col]
         else:
             files = os.path.basename(col)
 
-        # Copy render product "colorspace" data to representation.
-        colorspace = ""
-        products = additional_data["renderProducts"].layer_data.products
-        for product in products:
-            if product.productName == aov:
-                colorspace = product.colorspace
-                break
-
         rep = {
             "name": ext,
             "ext": ext,
             "files": files,
-            "frameStart": int(skeleton["frameStartHandle"]),
-            "frameEnd": int(skeleton["frameEndHandle"]),
+            "frameStart": frame_start,
+            "frameEnd": frame_end,
             # If expectedFile are absolute, we need only filenames
             "stagingDir": staging,
             "fps": new_instance.get("fps"),
             "tags": ["review"] if preview else [],
             "colorspaceData": {
-                "colorspace": colorspace,
+                # Copy render product "colorspace" data to representation.
+                "colorspace": colorspace_by_aov.get(aov, ""),
                 "config": {
                     "path": additional_data["colorspaceConfig"],
                     "template": additional_data["colorspaceTemplate"]
@@ -685,7 +742,7 @@ def _create_instances_for_aov(instance, skeleton, aov_filter, additional_data,
         }
 
         # support conversion from tiled to scanline
-        if instance.data.get("convertToScanline"):
+        if convert_to_scanline:
             log.info("Adding scanline conversion.")
             rep["tags"].append("toScanline")
 
@@ -704,7 +761,8 @@ def _create_instances_for_aov(instance, skeleton, aov_filter, additional_data,
         if new_instance.get("extendFrames", False):
             copy_extend_frames(new_instance, rep)
         instances.append(new_instance)
-        log.debug("instances:{}".format(instances))
+
+    log.debug("Created {} instances for AOVs".format(len(instances)))
     return instances
 
 
@@ -1,4 +1,5 @@
 from .utils import (
+    CONTAINERS_CHANGED_TOPIC,
     HeroVersionType,
 
     LoadError,
@@ -21,6 +22,7 @@ from .utils import (
     remove_container,
     update_container,
     switch_container,
+    emit_containers_changed,
 
     get_loader_identifier,
     get_loaders_by_name,
@@ -28,6 +30,8 @@ from .utils import (
     get_representation_path_from_context,
     get_representation_path,
     get_representation_path_with_anatomy,
+    get_version_resource_files,
+    get_representations_files,
 
     is_compatible_loader,
 
@@ -54,6 +58,7 @@ from .plugins import (
 
 __all__ = (
     # utils.py
+    "CONTAINERS_CHANGED_TOPIC",
     "HeroVersionType",
 
     "LoadError",
@@ -76,6 +81,7 @@ __all__ = (
     "remove_container",
     "update_container",
     "switch_container",
+    "emit_containers_changed",
 
     "get_loader_identifier",
     "get_loaders_by_name",
@@ -83,6 +89,8 @@ __all__ = (
     "get_representation_path_from_context",
     "get_representation_path",
     "get_representation_path_with_anatomy",
+    "get_version_resource_files",
+    "get_representations_files",
 
     "is_compatible_loader",
 
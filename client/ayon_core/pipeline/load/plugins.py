@@ -4,6 +4,7 @@ import logging
 from ayon_core.settings import get_project_settings
 from ayon_core.pipeline.plugin_discover import (
     discover,
+    create_plugin_subclass,
     register_plugin,
     register_plugin_path,
     deregister_plugin,
@@ -257,7 +258,11 @@ def discover_loader_plugins(project_name=None):
     from ayon_core.pipeline import get_current_project_name
 
     log = Logger.get_logger("LoaderDiscover")
-    plugins = discover(LoaderPlugin)
+    # Settings are applied to subclasses, discovered classes are shared
+    plugins = [
+        create_plugin_subclass(plugin)
+        for plugin in discover(LoaderPlugin)
+    ]
     if not project_name:
         project_name = get_current_project_name()
     project_settings = get_project_settings(project_name)
@@ -13,19 +13,48 @@ from ayon_core.host import ILoadHost
 from ayon_core.lib import (
     StringTemplate,
     TemplateUnsolved,
+    emit_event,
 )
 from ayon_core.pipeline import (
     Anatomy,
+    get_shared_anatomy,
 )
+from ayon_core.pipeline.constants import VERSION_RESOURCE_FILES_KEY
 
 log = logging.getLogger(__name__)
 
+# Topic of global event emitted when containers in scene changed. Hosts can
+#   emit the event too when containers are changed out of load api.
+# - data contain 'change_type' ('added', 'removed' or 'updated')
+CONTAINERS_CHANGED_TOPIC = "containers.changed"
+
 ContainersFilterResult = collections.namedtuple(
     "ContainersFilterResult",
     ["latest", "outdated", "not_found", "invalid"]
 )
 
 
+def emit_containers_changed(change_type, containers=None):
+    """Emit global event that containers in scene changed.
+
+    Args:
+        change_type (str): 'added', 'removed' or 'updated'.
+        containers (Optional[list[dict[str, Any]]]): Changed containers if
+            are known.
+
+    """
+    try:
+        emit_event(
+            CONTAINERS_CHANGED_TOPIC,
+            {
+                "change_type": change_type,
+                "containers": list(containers or []),
+            }
+        )
+    except Exception:
+        log.warning("Failed to emit containers change", exc_info=True)
+
+
 class HeroVersionType(object):
     def __init__(self, version):
         assert isinstance(version, numbers.Integral), (
@@ -322,7 +351,9 @@ def load_with_repre_context(
     # Deprecated - to be removed in OpenPype 3.16.6 or 3.17.0.
     loader._fname = get_representation_path_from_context(repre_context)
 
-    return loader.load(repre_context, name, namespace, options)
+    result = loader.load(repre_context, name, namespace, options)
+    emit_containers_changed("added")
+    return result
 
 
 def load_with_product_context(
@@ -345,7 +376,9 @@ def load_with_product_context(
         )
     )
 
-    return Loader().load(product_context, name, namespace, options)
+    result = Loader().load(product_context, name, namespace, options)
+    emit_containers_changed("added")
+    return result
 
 
 def load_with_product_contexts(
@@ -372,7 +405,9 @@ def load_with_product_contexts(
         )
     )
 
-    return Loader().load(product_contexts, name, namespace, options)
+    result = Loader().load(product_contexts, name, namespace, options)
+    emit_containers_changed("added")
+    return result
 
 
 def load_container(
@@ -457,7 +492,9 @@ def remove_container(container):
             .format(container.get("loader"))
         )
 
-    return Loader().remove(container)
+    result = Loader().remove(container)
+    emit_containers_changed("removed", [container])
+    return result
 
 
 def update_container(container, version=-1):
@@ -536,7 +573,9 @@ def update_container(container, version=-1):
         "representation": new_representation,
     }
 
-    return Loader().update(container, context)
+    result = Loader().update(container, context)
+    emit_containers_changed("updated", [container])
+    return result
 
 
 def switch_container(container, representation, loader_plugin=None):
@@ -584,7 +623,9 @@ def switch_container(container, representation, loader_plugin=None):
 
     loader = loader_plugin(context)
 
-    return loader.switch(container, context)
+    result = loader.switch(container, context)
+    emit_containers_changed("updated", [container])
+    return result
 
 
 def get_representation_path_from_context(context):
@@ -598,7 +639,7 @@ def get_representation_path_from_context(context):
         project_entity
         and project_entity["name"] != get_current_project_name()
     ):
-        anatomy = Anatomy(project_entity["name"])
+        anatomy = get_shared_anatomy(project_entity["name"])
         root = anatomy.roots
 
     return get_representation_path(representation, root)
@@ -650,6 +691,85 @@ def get_representation_path_with_anatomy(repre_entity, anatomy):
     return path.normalized()
 
 
+def get_version_resource_files(version_entity):
+    """Resource files stored on version entity.
+
+    Integrator can store resource files of version (e.g. textures of a look)
+    once on version instead of adding them to 'files' of each
+    representation.
+
+    Args:
+        version_entity (dict[str, Any]): Version entity with 'data'.
+
+    Returns:
+        list[dict[str, Any]]: Resource file infos.
+
+    """
+    version_data = version_entity.get("data") or {}
+    return list(version_data.get(VERSION_RESOURCE_FILES_KEY) or [])
+
+
+def get_representations_files(
+    project_name, repre_entities, version_entities=None
+):
+    """Get 'files' of representations including version resource files.
+
+    Resource files stored on version are resolved for each representation
+    so the output is the same as if the resource files were stored on
+    the representations.
+
+    Args:
+        project_name (str): Project name.
+        repre_entities (Iterable[dict[str, Any]]): Representation entities.
+        version_entities (Optional[Iterable[dict[str, Any]]]): Parent
+            versions of representations with 'data'. Missing versions
+            are queried.
+
+    Returns:
+        dict[str, list[dict[str, Any]]]: File infos by representation id.
+
+    """
+    repre_entities = list(repre_entities)
+    version_entities_by_id = {
+        version_entity["id"]: version_entity
+        for version_entity in version_entities or []
+    }
+    missing_version_ids = {
+        repre_entity["versionId"]
+        for repre_entity in repre_entities
+        if repre_entity["versionId"] not in version_entities_by_id
+    }
+    if missing_version_ids:
+        version_entities_by_id.update({
+            version_entity["id"]: version_entity
+            for version_entity in ayon_api.get_versions(
+                project_name,
+                version_ids=missing_version_ids,
+                fields={"id", "data"},
+            )
+        })
+
+    resource_files_by_version_id = {
+        version_id: get_version_resource_files(version_entity)
+        for version_id, version_entity in version_entities_by_id.items()
+    }
+    output = {}
+    for repre_entity in repre_entities:
+        files = list(repre_entity.get("files") or [])
+        resource_files = resource_files_by_version_id.get(
+            repre_entity["versionId"]
+        )
+        if resource_files:
+            file_ids = {file_info.get("id") for file_info in files}
+            files.extend(
+                file_info
+                for file_info in resource_files
+                if file_info.get("id") not in file_ids
+            )
+        output[repre_entity["id"]] = files
+    return output
+
+
 def get_representation_path(representation, root=None):
     """Get filename from representation document
 
@@ -765,7 +885,7 @@ def get_representation_path_by_names(
         return
 
     if not anatomy:
-        anatomy = Anatomy(project_name)
+        anatomy = get_shared_anatomy(project_name)
 
     if representation:
         path = get_representation_path_with_anatomy(representation, anatomy)
@@ -1,5 +1,8 @@
 import os
+import copy
+import types
 import inspect
+import threading
 import traceback
 
 from ayon_core.lib import Logger
@@ -11,6 +14,70 @@ from ayon_core.lib.python_module_tools import (
 log = Logger.get_logger(__name__)
 
 
+def _get_path_signature(path):
+    """Signature of python files in a directory used for cache invalidation.
+
+    Args:
+        path (str): Path to directory with python files.
+
+    Returns:
+        tuple[tuple[str, int, int], ...]: Filenames with modification time
+            and size.
+
+    """
+    signature = []
+    try:
+        entries = list(os.scandir(path))
+    except OSError:
+        return tuple(signature)
+
+    for entry in entries:
+        if entry.name.startswith("_") or not entry.name.endswith(".py"):
+            continue
+        try:
+            stat = entry.stat()
+        except OSError:
+            continue
+        signature.append((entry.name, stat.st_mtime_ns, stat.st_size))
+    signature.sort()
+    return tuple(signature)
+
+
+class _PathModulesCacheItem:
+    """Modules loaded from a path."""
+
+    def __init__(self, signature, modules, crashed):
+        self.signature = signature
+        self.modules = modules
+        self.crashed = crashed
+
+
+def create_plugin_subclass(cls):
+    """Create subclass of discovered plugin class.
+
+    Discovered classes are cached and shared by all discover calls. Use
+    subclass to modify class attributes, e.g. to apply project settings,
+    without affecting other consumers of the class. Mutable class attributes
+    of the class are copied to the subclass.
+
+    Args:
+        cls (type): Discovered plugin class.
+
+    Returns:
+        type: Subclass with same name and module.
+
+    """
+    def _exec_body(namespace):
+        namespace["__module__"] = cls.__module__
+        namespace["__qualname__"] = cls.__qualname__
+        namespace["__doc__"] = cls.__doc__
+        for key, value in vars(cls).items():
+            if isinstance(value, (list, dict, set)):
+                namespace[key] = copy.deepcopy(value)
+
+    return types.new_class(cls.__name__, (cls, ), exec_body=_exec_body)
+
+
 class DiscoverResult:
     """Result of Plug-ins discovery of a single superclass type.
 
@@ -100,8 +167,11 @@ class PluginDiscoverContext(object):
     """Store and discover registered types nad registered paths to types.
 
     Keeps in memory all registered types and their paths. Paths are dynamically
-    loaded on discover so different discover calls won't return the same
-    class objects even if were loaded from same file.
+    loaded on discover. Loaded modules are cached by path and reused until
+    any python file in the path is added, removed or changed, so discover
+    calls return the same class objects. Discovered classes must not be
+    modified, use 'create_plugin_subclass' to get a class which can be
+    modified. Use 'force_reload' to load the files again.
     """
 
     def __init__(self):
@@ -110,6 +180,35 @@ class PluginDiscoverContext(object):
         self._last_discovered_plugins = {}
         # Store the last result to memory
         self._last_discovered_results = {}
+        # Loaded modules by path
+        self._modules_cache = {}
+        self._modules_cache_lock = threading.Lock()
+
+    def clear_cache(self):
+        """Clear cached modules so next discover loads files again."""
+        with self._modules_cache_lock:
+            self._modules_cache = {}
+
+    def _get_modules_from_path(self, path, force_reload):
+        signature = _get_path_signature(path)
+        with self._modules_cache_lock:
+            cache_item = self._modules_cache.get(path)
+
+        if (
+            not force_reload
+            and cache_item is not None
+            and cache_item.signature == signature
+        ):
+            return cache_item.modules, cache_item.crashed
+
+        # Files are loaded without lock, concurrent discover of the same
+        #   path may load it twice but both results are valid
+        modules, crashed = modules_from_path(path)
+        with self._modules_cache_lock:
+            self._modules_cache[path] = _PathModulesCacheItem(
+                signature, modules, crashed
+            )
+        return modules, crashed
 
     def get_last_discovered_plugins(self, superclass):
         """Access last discovered plugin by a subperclass.
@@ -126,7 +225,8 @@ class PluginDiscoverContext(object):
         superclass,
         allow_duplicates=True,
         ignore_classes=None,
-        return_report=False
+        return_report=False,
+        force_reload=False
     ):
         """Find and return subclasses of `superclass`
 
@@ -136,6 +236,8 @@ class PluginDiscoverContext(object):
             ignore_classes (list): List of classes that will be ignored
                 and not added to result.
             return_report (bool): Output will be full report if set to 'True'.
+            force_reload (bool): Load files from registered paths again
+                even if they did not change.
 
         Returns:
             Union[DiscoverResult, list[Any]]: Object holding successfully
@@ -168,7 +270,9 @@ class PluginDiscoverContext(object):
 
         # Include plug-ins from registered paths
         for path in registered_paths:
-            modules, crashed = modules_from_path(path)
+            modules, crashed = self._get_modules_from_path(
+                path, force_reload
+            )
             for item in crashed:
                 filepath, exc_info = item
                 result.crashed_file_paths[filepath] = exc_info
@@ -273,7 +377,8 @@ def discover(
     superclass,
     allow_duplicates=True,
     ignore_classes=None,
-    return_report=False
+    return_report=False,
+    force_reload=False
 ):
     """Find and return subclasses of `superclass`
 
@@ -283,6 +388,8 @@ def discover(
         ignore_classes (list): List of classes that will be ignored
             and not added to result.
         return_report (bool): Output will be full report if set to 'True'.
+        force_reload (bool): Load files from registered paths again
+            even if they did not change.
 
     Returns:
         Union[DiscoverResult, list[Any]]: Object holding successfully
@@ -295,10 +402,17 @@ def discover(
         superclass,
         allow_duplicates,
         ignore_classes,
-        return_report
+        return_report,
+        force_reload
     )
 
 
+def clear_discover_cache():
+    """Clear cached modules so next discover loads files again."""
+    context = _GlobalDiscover.get_context()
+    context.clear_cache()
+
+
 def get_last_discovered_plugins(superclass):
     context = _GlobalDiscover.get_context()
     return context.get_last_discovered_plugins(superclass)
@@ -1,13 +1,15 @@
 import os
 import re
 import json
+import collections
+from concurrent.futures import ThreadPoolExecutor
 
 import six
 
 from ayon_core.settings import get_project_settings
 from ayon_core.lib import Logger
 
-from .anatomy import Anatomy
+from .anatomy import get_shared_anatomy
 from .template_data import get_project_template_data
 
 
@@ -61,25 +63,125 @@ def fill_paths(path_list, anatomy):
     return filled_paths
 
 
-def create_project_folders(project_name, basic_paths=None):
+def _get_path_parents(path):
+    parents = []
+    while True:
+        parent = os.path.dirname(path)
+        if not parent or parent == path:
+            break
+        parents.append(parent)
+        path = parent
+    return parents
+
+
+def plan_project_folders(paths, max_workers=None):
+    """Find folders which have to be created.
+
+    Paths are deduplicated and their existence is checked from top level
+    folders down, children of missing folders are not checked at all.
+    Checks of folders at the same depth run in parallel, which matters on
+    network storage where each check is a round-trip.
+
+    Args:
+        paths (Iterable[str]): Folder paths that should exist.
+        max_workers (Optional[int]): Maximum number of parallel checks.
+
+    Returns:
+        list[str]: Deepest missing folders. Creation of these folders
+            creates all missing folders.
+
+    """
+    children_by_path = collections.defaultdict(set)
+    top_paths = set()
+    for path in {os.path.normpath(path) for path in paths}:
+        parents = _get_path_parents(path)
+        child = path
+        for parent in parents:
+            children_by_path[parent].add(child)
+            child = parent
+        top_paths.add(child)
+
+    def get_leaves(path):
+        leaves = []
+        queue = collections.deque([path])
+        while queue:
+            item = queue.popleft()
+            children = children_by_path.get(item)
+            if children:
+                queue.extend(children)
+            else:
+                leaves.append(item)
+        return leaves
+
+    missing = []
+    level = sorted(top_paths)
+    with ThreadPoolExecutor(max_workers=max_workers) as executor:
+        while level:
+            next_level = []
+            for path, exists in zip(
+                level, executor.map(os.path.isdir, level)
+            ):
+                if exists:
+                    next_level.extend(children_by_path.get(path, ()))
+                else:
+                    missing.extend(get_leaves(path))
+            level = sorted(next_level)
+    return missing
+
+
+def create_folders(paths, max_workers=None):
+    """Create missing folders concurrently.
+
+    Args:
+        paths (Iterable[str]): Folder paths that should exist.
+        max_workers (Optional[int]): Maximum number of parallel
+            filesystem operations.
+
+    Returns:
+        list[str]: Created folders, deepest folder of each created tree.
+
+    """
+    missing = plan_project_folders(paths, max_workers)
+    if missing:
+        with ThreadPoolExecutor(max_workers=max_workers) as executor:
+            # Parents shared by multiple paths may be created by other
+            #   thread, 'exist_ok' handles that
+            list(executor.map(
+                lambda path: os.makedirs(path, exist_ok=True), missing
+            ))
+    return missing
+
+
+def create_project_folders(project_name, basic_paths=None, max_workers=8):
+    """Create folder structure of project from settings.
+
+    Args:
+        project_name (str): Project name.
+        basic_paths (Optional[list]): Paths from 'get_project_basic_paths'.
+        max_workers (Optional[int]): Maximum number of parallel
+            filesystem operations.
+
+    Returns:
+        list[str]: Created folders.
+
+    """
     log = Logger.get_logger("create_project_folders")
-    anatomy = Anatomy(project_name)
+    anatomy = get_shared_anatomy(project_name)
     if basic_paths is None:
         basic_paths = get_project_basic_paths(project_name)
 
     if not basic_paths:
-        return
+        return []
 
     concat_paths = concatenate_splitted_paths(basic_paths, anatomy)
     filled_paths = fill_paths(concat_paths, anatomy)
 
-    # Create folders
-    for path in filled_paths:
-        if os.path.exists(path):
-            log.debug("Folder already exists: {}".format(path))
-        else:
-            log.debug("Creating folder: {}".format(path))
-            os.makedirs(path)
+    created = create_folders(filled_paths, max_workers)
+    for path in created:
+        log.debug("Created folder: {}".format(path))
+    if not created:
+        log.debug("All project folders already exist")
+    return created
 
 
 def _list_path_items(folder_structure):
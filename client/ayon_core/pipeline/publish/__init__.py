@@ -42,6 +42,20 @@ from .lib import (
     get_plugin_settings,
     get_publish_instance_label,
     get_publish_instance_families,
+    get_publish_directory_scanner,
+)
+
+from .extraction_jobs import (
+    is_extraction_offload_enabled,
+    submit_extraction_job,
+    wait_for_extraction_jobs,
+    wait_for_representations_extraction_jobs,
+)
+
+from .input_tracing import (
+    NodeGraphAdapter,
+    InputTracer,
+    get_input_tracer,
 )
 
 from .abstract_expected_files import ExpectedFiles
@@ -91,6 +105,16 @@ __all__ = (
     "get_plugin_settings",
     "get_publish_instance_label",
     "get_publish_instance_families",
+    "get_publish_directory_scanner",
+
+    "is_extraction_offload_enabled",
+    "submit_extraction_job",
+    "wait_for_extraction_jobs",
+    "wait_for_representations_extraction_jobs",
+
+    "NodeGraphAdapter",
+    "InputTracer",
+    "get_input_tracer",
 
     "ExpectedFiles",
 
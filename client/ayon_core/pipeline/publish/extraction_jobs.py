@@ -0,0 +1,244 @@
+"""Hand over extraction commands to local extraction jobs service.
+
+The service runs in tray webserver (see
+'ayon_core.modules.webserver.extraction_jobs'). Extract plugins can submit
+commands and continue. Job ids are stored on instance and on representation
+which will contain the outputs. Plugins reading files of representations
+must call 'wait_for_representations_extraction_jobs' first,
+'WaitForExtractionJobs' plugin waits for all jobs of an instance before
+integration.
+
+Offload is used only if it is enabled in context data
+('offloadExtraction') and the webserver with its token is available,
+otherwise commands are processed in current process.
+"""
+
+import os
+import json
+import time
+import urllib.request
+
+from ayon_core.lib import (
+    Logger,
+    run_subprocess,
+    get_oiio_tool_args,
+    get_ffmpeg_tool_args,
+)
+
+from .publish_plugins import KnownPublishError
+
+EXTRACTION_JOBS_ROUTE = "/extraction/jobs"
+EXTRACTION_JOBS_TOKEN_ENV = "AYON_EXTRACTION_JOBS_TOKEN"
+EXTRACTION_JOBS_TOKEN_HEADER = "X-Ayon-Extraction-Token"
+INSTANCE_JOB_IDS_KEY = "extractionJobIds"
+REPRESENTATION_JOB_IDS_KEY = "extractionJobIds"
+
+TOOL_ARGS_GETTERS = {
+    "oiiotool": get_oiio_tool_args,
+    "ffmpeg": get_ffmpeg_tool_args,
+}
+
+
+def _get_jobs_url():
+    webserver_url = os.environ.get("AYON_WEBSERVER_URL")
+    if not webserver_url or not os.environ.get(EXTRACTION_JOBS_TOKEN_ENV):
+        return None
+    return webserver_url.rstrip("/") + EXTRACTION_JOBS_ROUTE
+
+
+def _request(url, data=None, timeout=10):
+    headers = {
+        EXTRACTION_JOBS_TOKEN_HEADER: os.environ.get(
+            EXTRACTION_JOBS_TOKEN_ENV, ""
+        )
+    }
+    body = None
+    if data is not None:
+        body = json.dumps(data).encode("utf-8")
+        headers["Content-Type"] = "application/json"
+    request = urllib.request.Request(url, data=body, headers=headers)
+    with urllib.request.urlopen(request, timeout=timeout) as response:
+        return json.loads(response.read().decode("utf-8"))
+
+
+def is_extraction_offload_enabled(context):
+    """Extraction commands can be handed over to extraction jobs service.
+
+    Args:
+        context (pyblish.api.Context): Publish context.
+
+    Returns:
+        bool: Offload is enabled and service url is known.
+
+    """
+    return bool(context.data.get("offloadExtraction")) and bool(
+        _get_jobs_url()
+    )
+
+
+def submit_extraction_job(
+    instance,
+    steps,
+    outputs=None,
+    priority=None,
+    label=None,
+    representation=None,
+    logger=None,
+):
+    """Submit extraction commands of instance.
+
+    Commands are processed in current process if offload is not enabled or
+    service is not available.
+
+    Files of offloaded job may not exist when this function returns. Any
+    plugin reading files of 'representation' before 'WaitForExtractionJobs'
+    (order 'IntegratorOrder - 0.2') must call
+    'wait_for_representations_extraction_jobs' with the representation
+    first. Outputs of jobs submitted without 'representation' are
+    available only after 'WaitForExtractionJobs'.
+
+    Args:
+        instance (pyblish.api.Instance): Publish instance.
+        steps (list[dict[str, Any]]): Steps with 'tool' ('oiiotool' or
+            'ffmpeg'), 'args' with arguments of the tool and optional 'id'
+            and 'depends_on'. Steps are processed in order of dependencies.
+        outputs (Optional[list[str]]): Paths that must exist after job.
+        priority (Optional[int]): Lower value is processed first.
+        label (Optional[str]): Job label.
+        representation (Optional[dict[str, Any]]): Representation which
+            will contain outputs of the job.
+        logger (Optional[logging.Logger]): Logger used for output.
+
+    Returns:
+        Union[str, None]: Job id if was submitted to service.
+
+    """
+    if logger is None:
+        logger = Logger.get_logger("ExtractionJobs")
+
+    if is_extraction_offload_enabled(instance.context):
+        try:
+            job_data = _request(_get_jobs_url(), {
+                "steps": steps,
+                "outputs": outputs or [],
+                "priority": priority,
+                "label": label,
+            })
+        except Exception:
+            logger.warning(
+                "Failed to submit extraction job. Processing locally.",
+                exc_info=True
+            )
+        else:
+            job_id = job_data["id"]
+            instance.data.setdefault(INSTANCE_JOB_IDS_KEY, []).append(job_id)
+            if representation is not None:
+                representation.setdefault(
+                    REPRESENTATION_JOB_IDS_KEY, []
+                ).append(job_id)
+            logger.debug("Submitted extraction job '{}'".format(job_id))
+            return job_id
+
+    for step in steps:
+        tool = step["tool"]
+        args = TOOL_ARGS_GETTERS[tool](tool, *step["args"])
+        run_subprocess(args, logger=logger)
+    return None
+
+
+def wait_for_representations_extraction_jobs(
+    representations, timeout=None, logger=None
+):
+    """Wait for extraction jobs creating files of representations.
+
+    Args:
+        representations (Iterable[dict[str, Any]]): Representations.
+        timeout (Optional[float]): Maximum wait time in seconds.
+        logger (Optional[logging.Logger]): Logger used for output.
+
+    Raises:
+        KnownPublishError: When any job failed or timeout was reached.
+
+    """
+    job_ids = []
+    representations = list(representations)
+    for repre in representations:
+        job_ids.extend(repre.get(REPRESENTATION_JOB_IDS_KEY) or [])
+
+    if not job_ids:
+        return
+
+    wait_for_extraction_jobs(job_ids, timeout=timeout, logger=logger)
+    for repre in representations:
+        repre.pop(REPRESENTATION_JOB_IDS_KEY, None)
+
+
+def wait_for_extraction_jobs(
+    job_ids, timeout=None, poll_interval=0.5, logger=None
+):
+    """Wait until extraction jobs are done.
+
+    Args:
+        job_ids (Iterable[str]): Ids of submitted jobs.
+        timeout (Optional[float]): Maximum wait time in seconds.
+        poll_interval (Optional[float]): Time between status checks.
+        logger (Optional[logging.Logger]): Logger used for output.
+
+    Raises:
+        KnownPublishError: When any job failed, is not known by service
+            or timeout was reached.
+
+    """
+    if logger is None:
+        logger = Logger.get_logger("ExtractionJobs")
+
+    jobs_url = _get_jobs_url()
+    remaining = list(job_ids)
+    if not remaining:
+        return
+
+    if not jobs_url:
+        raise KnownPublishError(
+            "Extraction jobs service is not available."
+        )
+
+    start_time = time.time()
+    failed = []
+    while remaining:
+        for job_id in tuple(remaining):
+            try:
+                job_data = _request("{}/{}".format(jobs_url, job_id))
+            except Exception as exc:
+                raise KnownPublishError(
+                    "Failed to get extraction job '{}': {}".format(
+                        job_id, exc
+                    )
+                )
+
+            if job_data["status"] == "finished":
+                remaining.remove(job_id)
+            elif job_data["status"] == "failed":
+                remaining.remove(job_id)
+                failed.append(job_data)
+
+        if not remaining:
+            break
+
+        if timeout is not None and time.time() - start_time > timeout:
+            raise KnownPublishError(
+                "Extraction jobs did not finish in time: {}".format(
+                    ", ".join(remaining)
+                )
+            )
+        logger.debug(
+            "Waiting for {} extraction jobs".format(len(remaining))
+        )
+        time.sleep(poll_interval)
+
+    if failed:
+        raise KnownPublishError("Extraction jobs failed:\n{}".format(
+            "\n".join(
+                "- {}: {}".format(job_data["label"], job_data["error"])
+                for job_data in failed
+            )
+        ))
@@ -0,0 +1,213 @@
+"""Trace loaded containers used as inputs of published instances.
+
+Collectors of inputs usually traverse upstream nodes of each instance and
+check membership of each node in each loaded container. The tracer builds
+reverse index of container members once per publish and memoizes upstream
+traversal of nodes, so instances sharing upstream graph don't query the
+host again.
+
+Hosts only implement 'NodeGraphAdapter' for their node graph.
+
+Example:
+    >>> tracer = get_input_tracer(instance.context, HoudiniGraphAdapter)
+    >>> containers = tracer.get_input_containers(output_node)
+    >>> inputs = [c["representation"] for c in containers]
+"""
+
+from collections import deque
+
+INPUT_TRACER_KEY = "inputTracer"
+
+
+class NodeGraphAdapter:
+    """Access to node graph of host used by 'InputTracer'.
+
+    Upstream of a node are its ancestors and its references. Ancestors are
+    expected to be already resolved recursively by host (e.g. all input
+    connections), references are nodes used by the node in other way
+    (e.g. expressions). Ancestors of references and references of all
+    upstream nodes are traversed by the tracer.
+
+    Nodes must be hashable.
+    """
+
+    def get_containers(self):
+        """Loaded containers in scene.
+
+        Returns:
+            list[dict[str, Any]]: Containers in scene.
+
+        """
+        raise NotImplementedError
+
+    def get_container_members(self, container):
+        """Member nodes of container.
+
+        Returns:
+            Iterable[Any]: Nodes of container.
+
+        """
+        raise NotImplementedError
+
+    def get_ancestors(self, node):
+        """All nodes upstream of the node by input connections.
+
+        Returns:
+            Iterable[Any]: Upstream nodes.
+
+        """
+        raise NotImplementedError
+
+    def get_references(self, node):
+        """Nodes referenced by the node.
+
+        Returns:
+            Iterable[Any]: Referenced nodes.
+
+        """
+        return []
+
+
+class InputTracer:
+    """Find loaded containers used as inputs of nodes.
+
+    Containers and their members are queried on first use. Upstream of each
+    traced node is cached, so the tracer should live only during one publish
+    (see 'get_input_tracer').
+
+    Args:
+        adapter (NodeGraphAdapter): Node graph of host.
+
+    """
+    def __init__(self, adapter):
+        self._adapter = adapter
+        self._containers = None
+        self._container_indexes_by_member = None
+        self._ancestors_cache = {}
+        self._references_cache = {}
+        self._upstream_cache = {}
+
+    @property
+    def containers(self):
+        """Loaded containers in scene.
+
+        Returns:
+            list[dict[str, Any]]: Containers in scene.
+
+        """
+        self._build_index()
+        return self._containers
+
+    def get_upstream(self, node):
+        """All upstream nodes of the node, including the node itself.
+
+        Returns:
+            set[Any]: Upstream nodes. Result is cached and must not be
+                modified.
+
+        """
+        upstream = self._upstream_cache.get(node)
+        if upstream is not None:
+            return upstream
+
+        upstream = {node}
+        # Each queue item is node and if its ancestors should be collected,
+        #   nodes collected as ancestors already have theirs collected
+        queue = deque([(node, True)])
+        while queue:
+            item, add_ancestors = queue.popleft()
+            cached = self._upstream_cache.get(item)
+            if cached is not None:
+                upstream |= cached
+                continue
+
+            new_nodes = []
+            if add_ancestors:
+                new_nodes.extend(
+                    (ancestor, False)
+                    for ancestor in self._get_ancestors(item)
+                )
+            new_nodes.extend(
+                (reference, True)
+                for reference in self._get_references(item)
+            )
+            for new_node, new_add_ancestors in new_nodes:
+                if new_node in upstream:
+                    continue
+                upstream.add(new_node)
+                queue.append((new_node, new_add_ancestors))
+
+        self._upstream_cache[node] = upstream
+        return upstream
+
+    def get_input_containers(self, nodes):
+        """Containers having any member upstream of the nodes.
+
+        Args:
+            nodes (Union[Any, Iterable[Any]]): Output node or nodes.
+
+        Returns:
+            list[dict[str, Any]]: Containers in order of scene containers.
+
+        """
+        if isinstance(nodes, (list, tuple, set, frozenset)):
+            upstream = set()
+            for node in nodes:
+                upstream |= self.get_upstream(node)
+        else:
+            upstream = self.get_upstream(nodes)
+
+        self._build_index()
+        indexes = set()
+        for node in upstream:
+            node_indexes = self._container_indexes_by_member.get(node)
+            if node_indexes:
+                indexes.update(node_indexes)
+
+        return [self._containers[index] for index in sorted(indexes)]
+
+    def _build_index(self):
+        if self._containers is not None:
+            return
+
+        containers = list(self._adapter.get_containers())
+        indexes_by_member = {}
+        for index, container in enumerate(containers):
+            for member in self._adapter.get_container_members(container):
+                indexes_by_member.setdefault(member, []).append(index)
+
+        self._containers = containers
+        self._container_indexes_by_member = indexes_by_member
+
+    def _get_ancestors(self, node):
+        ancestors = self._ancestors_cache.get(node)
+        if ancestors is None:
+            ancestors = tuple(self._adapter.get_ancestors(node))
+            self._ancestors_cache[node] = ancestors
+        return ancestors
+
+    def _get_references(self, node):
+        references = self._references_cache.get(node)
+        if references is None:
+            references = tuple(self._adapter.get_references(node))
+            self._references_cache[node] = references
+        return references
+
+
+def get_input_tracer(context, adapter_cls):
+    """Input tracer shared by instances of publish context.
+
+    Args:
+        context (pyblish.api.Context): Publish context.
+        adapter_cls (type[NodeGraphAdapter]): Adapter of host node graph,
+            created when tracer is not available yet.
+
+    Returns:
+        InputTracer: Input tracer of the publish.
+
+    """
+    tracer = context.data.get(INPUT_TRACER_KEY)
+    if tracer is None:
+        tracer = InputTracer(adapter_cls())
+        context.data[INPUT_TRACER_KEY] = tracer
+    return tracer
@@ -14,11 +14,12 @@ from ayon_core.lib import (
     Logger,
     import_filepath,
     filter_profiles,
+    DirectoryScanner,
 )
 from ayon_core.settings import get_project_settings
 from ayon_core.pipeline import (
     tempdir,
-    Anatomy
+    get_shared_anatomy,
 )
 from ayon_core.pipeline.plugin_discover import DiscoverResult
 from .constants import (
@@ -27,6 +28,8 @@ from .constants import (
     TRANSIENT_DIR_TEMPLATE
 )
 
+DIRECTORY_SCANNER_KEY = "directoryScanner"
+
 
 def get_template_name_profiles(
     project_name, project_settings=None, logger=None
@@ -738,7 +741,7 @@ def get_custom_staging_dir_info(
         return None, None
 
     if not anatomy:
-        anatomy = Anatomy(project_name)
+        anatomy = get_shared_anatomy(project_name)
 
     template_name = profile["template_name"] or TRANSIENT_DIR_TEMPLATE
 
@@ -978,3 +981,24 @@ def get_instance_expected_output_path(
     path_template_obj = anatomy.get_template_item("publish", "default")["path"]
     template_filled = path_template_obj.format_strict(template_data)
     return os.path.normpath(template_filled)
+
+
+def get_publish_directory_scanner(context):
+    """Directory scanner shared by plugins of publish context.
+
+    Render output directories are usually validated and collected by
+    multiple plugins and instances, shared scanner lists each directory
+    only once unless its content changes.
+
+    Args:
+        context (pyblish.api.Context): Publish context.
+
+    Returns:
+        DirectoryScanner: Directory scanner of the publish.
+
+    """
+    scanner = context.data.get(DIRECTORY_SCANNER_KEY)
+    if scanner is None:
+        scanner = DirectoryScanner()
+        context.data[DIRECTORY_SCANNER_KEY] = scanner
+    return scanner
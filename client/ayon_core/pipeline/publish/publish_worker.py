@@ -0,0 +1,487 @@
+"""Long living publish worker processing farm publish jobs.
+
+Headless publish ('ayon publish <json>') initializes addons, collects and
+discovers plugins and fetches settings before the job is processed. The
+worker does the initialization once and then processes publish jobs
+received on a local socket one by one. Clients waiting for the worker are
+queued in socket backlog.
+
+Each job is processed with environment sent by the client and the
+environment of the worker is restored after the job is done. Discovered
+plugins (with applied settings) are cached per project for
+'plugins_cache_lifetime' seconds.
+
+Jobs must contain secret token of the worker. The token is taken from
+'AYON_PUBLISH_WORKER_TOKEN' or generated on start and stored to file
+readable only by the user running the worker. Connection to server
+('AYON_SERVER_URL', 'AYON_API_KEY') is never taken from the job, jobs
+with different server or key are rejected and client should publish in
+its own process. User of the job ('AYON_USERNAME') is used as default
+service user during the job, same as in 'ayon publish'.
+
+Using the worker is opt-in. Farm jobs use it when 'publish' is called
+with '--use-worker' or when 'AYON_PUBLISH_USE_WORKER' is set to "1" in
+job environment.
+
+Protocol:
+    Client sends one json line with 'token', 'path', 'targets' and 'env'.
+    Worker responds with one json line with 'success', 'rejected', 'error'
+    and 'results'.
+"""
+
+import os
+import sys
+import json
+import time
+import hmac
+import secrets
+import socket
+import socketserver
+import traceback
+
+from ayon_core.lib import Logger
+from ayon_core.lib.local_settings import get_ayon_appdirs
+
+DEFAULT_WORKER_PORT = 47260
+WORKER_PORT_ENV_KEY = "AYON_PUBLISH_WORKER_PORT"
+WORKER_TOKEN_ENV_KEY = "AYON_PUBLISH_WORKER_TOKEN"
+USE_WORKER_ENV_KEY = "AYON_PUBLISH_USE_WORKER"
+# Connection of worker, values are never used from job environment
+PROTECTED_ENV_KEYS = (
+    "AYON_SERVER_URL",
+    "AYON_API_KEY",
+)
+
+LEGACY_ENV_KEYS = (
+    ("AVALON_PROJECT", "AYON_PROJECT_NAME"),
+    ("AVALON_ASSET", "AYON_FOLDER_PATH"),
+    ("AVALON_TASK", "AYON_TASK_NAME"),
+    ("AVALON_WORKDIR", "AYON_WORKDIR"),
+    ("AVALON_APP_NAME", "AYON_APP_NAME"),
+    ("AVALON_APP", "AYON_HOST_NAME"),
+)
+
+
+def fix_legacy_env_keys(env):
+    """Convert legacy environment keys of older jobs.
+
+    Args:
+        env (MutableMapping[str, str]): Environment to modify.
+
+    """
+    for src_key, dst_key in LEGACY_ENV_KEYS:
+        if src_key in env and dst_key not in env:
+            env[dst_key] = env[src_key]
+        # Remove old keys, so we're sure they're not used
+        env.pop(src_key, None)
+
+
+def is_worker_enabled():
+    """Publish worker should be used by 'ayon publish'.
+
+    Returns:
+        bool: 'AYON_PUBLISH_USE_WORKER' is enabled.
+
+    """
+    value = os.environ.get(USE_WORKER_ENV_KEY) or ""
+    return value.lower() in ("1", "true", "yes")
+
+
+def _set_service_username(username):
+    """Make public ayon api behave as other user.
+
+    This works only if public ayon api is using service user.
+
+    Args:
+        username (Union[str, None]): Username or None to use service user.
+
+    """
+    import ayon_api
+
+    # NOTE: ayon-python-api does not have public api function to find
+    #   out if is used service user. So we need to have try > except
+    #   block.
+    con = ayon_api.get_server_api_connection()
+    try:
+        con.set_default_service_username(username)
+    except ValueError:
+        pass
+
+
+def get_worker_port():
+    """Port of publish worker.
+
+    Returns:
+        int: Port from 'AYON_PUBLISH_WORKER_PORT' or default port.
+
+    """
+    port = os.environ.get(WORKER_PORT_ENV_KEY)
+    if port:
+        try:
+            return int(port)
+        except ValueError:
+            pass
+    return DEFAULT_WORKER_PORT
+
+
+def _get_token_filepath(port):
+    return get_ayon_appdirs("publish_worker", "{}.token".format(port))
+
+
+def get_worker_token(port=None):
+    """Secret token of publish worker running on port.
+
+    Args:
+        port (Optional[int]): Port of publish worker.
+
+    Returns:
+        str: Token from 'AYON_PUBLISH_WORKER_TOKEN' or from token file.
+
+    Raises:
+        OSError: Token file is not available.
+
+    """
+    token = os.environ.get(WORKER_TOKEN_ENV_KEY)
+    if token:
+        return token
+    if port is None:
+        port = get_worker_port()
+    with open(_get_token_filepath(port), "r") as stream:
+        return stream.read().strip()
+
+
+def _create_worker_token(port):
+    """Generate token and store it to file readable only by current user.
+
+    Returns:
+        str: Generated token.
+
+    """
+    token = secrets.token_hex(32)
+    filepath = _get_token_filepath(port)
+    os.makedirs(os.path.dirname(filepath), exist_ok=True)
+    if os.path.exists(filepath):
+        os.remove(filepath)
+    fd = os.open(filepath, os.O_WRONLY | os.O_CREAT | os.O_EXCL, 0o600)
+    with os.fdopen(fd, "w") as stream:
+        stream.write(token)
+    return token
+
+
+def _format_record(record):
+    try:
+        return "{}: {}".format(record.levelname, record.getMessage())
+    except Exception:
+        return str(getattr(record, "msg", record))
+
+
+class _PublishJobHandler(socketserver.StreamRequestHandler):
+    def handle(self):
+        line = self.rfile.readline()
+        if not line:
+            return
+        try:
+            job_data = json.loads(line.decode("utf-8"))
+            token = job_data.get("token")
+            if (
+                not isinstance(token, str)
+                or not hmac.compare_digest(token, self.server.token)
+            ):
+                response = {
+                    "success": False,
+                    "rejected": True,
+                    "error": "Invalid publish worker token.",
+                    "results": [],
+                }
+            else:
+                response = self.server.worker.process_job(job_data)
+        except Exception:
+            response = {
+                "success": False,
+                "rejected": False,
+                "error": traceback.format_exc(),
+                "results": [],
+            }
+        self.wfile.write((json.dumps(response) + "\n").encode("utf-8"))
+
+
+class _PublishWorkerServer(socketserver.TCPServer):
+    allow_reuse_address = True
+
+    def __init__(self, worker, address, token):
+        self.worker = worker
+        self.token = token
+        super(_PublishWorkerServer, self).__init__(
+            address, _PublishJobHandler
+        )
+
+
+class PublishWorker:
+    """Process publish jobs in warm process.
+
+    Args:
+        port (Optional[int]): Port where worker listens. Worker listens
+            only on localhost.
+        plugins_cache_lifetime (Optional[int]): Seconds for which
+            discovered plugins of a project are reused.
+
+    """
+    def __init__(self, port=None, plugins_cache_lifetime=600):
+        if port is None:
+            port = get_worker_port()
+        self.port = port
+        self.plugins_cache_lifetime = plugins_cache_lifetime
+        self.log = Logger.get_logger(self.__class__.__name__)
+
+        self._addons_manager = None
+        self._base_env = None
+        self._plugins_cache = {}
+        self._server = None
+
+    def warm_up(self):
+        """Initialize addons and register plugin paths."""
+        import pyblish.api
+
+        from ayon_core.addon import AddonsManager
+        from ayon_core.pipeline import install_ayon_plugins
+
+        fix_legacy_env_keys(os.environ)
+        install_ayon_plugins()
+
+        manager = AddonsManager()
+        for plugin_path in manager.collect_plugin_paths()["publish"]:
+            pyblish.api.register_plugin_path(plugin_path)
+
+        pyblish.api.register_host("shell")
+
+        self._addons_manager = manager
+        self._base_env = dict(os.environ)
+
+    def serve_forever(self):
+        """Warm up and process jobs until interrupted."""
+        if self._base_env is None:
+            self.warm_up()
+
+        token = os.environ.get(WORKER_TOKEN_ENV_KEY)
+        if not token:
+            token = _create_worker_token(self.port)
+        self._server = _PublishWorkerServer(
+            self, ("127.0.0.1", self.port), token
+        )
+        self.log.info(
+            "Publish worker is listening on port {}".format(self.port)
+        )
+        try:
+            self._server.serve_forever()
+        finally:
+            self._server.server_close()
+            self._server = None
+
+    def stop(self):
+        if self._server is not None:
+            self._server.shutdown()
+
+    def _get_plugins(self, project_name):
+        import pyblish.api
+
+        now = time.time()
+        cached = self._plugins_cache.get(project_name)
+        if cached is not None:
+            created, plugins = cached
+            if now - created < self.plugins_cache_lifetime:
+                return plugins
+
+        # Settings are applied to plugins by discovery filter
+        plugins = pyblish.api.discover()
+        self._plugins_cache[project_name] = (now, plugins)
+        return plugins
+
+    def _get_rejection_reason(self, job_env):
+        """Job can't be processed with connection of the worker.
+
+        Returns:
+            Union[str, None]: Reason why job is rejected.
+
+        """
+        for key in PROTECTED_ENV_KEYS:
+            value = job_env.get(key)
+            if value and value != self._base_env.get(key):
+                return (
+                    "Job '{}' differs from publish worker.".format(key)
+                )
+        return None
+
+    def _prepare_environment(self, job_env):
+        from ayon_core.pipeline import get_global_context
+
+        os.environ.clear()
+        os.environ.update(self._base_env)
+        os.environ.update({
+            key: value
+            for key, value in job_env.items()
+            if key not in PROTECTED_ENV_KEYS
+        })
+        fix_legacy_env_keys(os.environ)
+
+        username = os.environ.get("AYON_USERNAME")
+        if username:
+            _set_service_username(username)
+
+        applications_addon = self._addons_manager.get_enabled_addon(
+            "applications"
+        )
+        if applications_addon is not None:
+            context = get_global_context()
+            env = applications_addon.get_farm_publish_environment_variables(
+                context["project_name"],
+                context["folder_path"],
+                context["task_name"],
+            )
+            os.environ.update(env)
+
+    def _restore_environment(self):
+        os.environ.clear()
+        os.environ.update(self._base_env)
+        _set_service_username(self._base_env.get("AYON_USERNAME") or None)
+
+    def process_job(self, job_data):
+        """Process one publish job.
+
+        Args:
+            job_data (dict[str, Any]): Job with 'path' to publish json,
+                optional 'targets' and 'env'.
+
+        Returns:
+            dict[str, Any]: Result with 'success', 'rejected', 'error'
+                and 'results'.
+
+        """
+        import pyblish.util
+
+        path = job_data.get("path")
+        if not isinstance(path, str):
+            raise RuntimeError("Path to JSON must be a string.")
+
+        job_env = job_data.get("env") or {}
+        reason = self._get_rejection_reason(job_env)
+        if reason:
+            self.log.info(
+                "Rejected publish job '{}': {}".format(path, reason)
+            )
+            return {
+                "success": False,
+                "rejected": True,
+                "error": reason,
+                "results": [],
+            }
+
+        targets = list(job_data.get("targets") or []) or ["farm"]
+        self.log.info("Processing publish job '{}'".format(path))
+        start_time = time.time()
+        results = []
+        error = None
+        try:
+            self._prepare_environment(job_env)
+            os.environ["AYON_PUBLISH_DATA"] = path
+            os.environ["HEADLESS_PUBLISH"] = "true"
+
+            plugins = self._get_plugins(os.environ.get("AYON_PROJECT_NAME"))
+            error_format = (
+                "Failed {plugin.__name__}: {error} -- {error.traceback}"
+            )
+            # New context is created for each job
+            for result in pyblish.util.publish_iter(
+                plugins=plugins, targets=targets
+            ):
+                instance = result["instance"]
+                results.append({
+                    "plugin": result["plugin"].__name__,
+                    "instance": str(instance) if instance else None,
+                    "success": result["success"],
+                    "records": [
+                        _format_record(record)
+                        for record in result.get("records") or []
+                    ],
+                })
+                if result["error"]:
+                    error = error_format.format(**result)
+                    break
+
+        except Exception:
+            error = traceback.format_exc()
+
+        finally:
+            self._restore_environment()
+
+        self.log.info("Publish job '{}' {} in {:.2f}s".format(
+            path, "failed" if error else "finished", time.time() - start_time
+        ))
+        return {
+            "success": error is None,
+            "rejected": False,
+            "error": error,
+            "results": results,
+        }
+
+
+def submit_publish_job(path, targets=None, env=None, port=None):
+    """Process publish job in running publish worker.
+
+    Args:
+        path (str): Path to publish json.
+        targets (Optional[list[str]]): Pyblish targets.
+        env (Optional[dict[str, str]]): Environment of the job. Current
+            environment is used if not passed.
+        port (Optional[int]): Port of publish worker.
+
+    Returns:
+        dict[str, Any]: Result with 'success', 'rejected', 'error'
+            and 'results'. Rejected job was not processed and should be
+            published in current process.
+
+    Raises:
+        OSError: Worker is not running or its token is not available.
+
+    """
+    if port is None:
+        port = get_worker_port()
+    if env is None:
+        env = dict(os.environ)
+
+    token = get_worker_token(port)
+    data = json.dumps({
+        "token": token,
+        "path": path,
+        "targets": list(targets or []),
+        "env": env,
+    }) + "\n"
+    with socket.create_connection(("127.0.0.1", port)) as conn:
+        conn.sendall(data.encode("utf-8"))
+        with conn.makefile("rb") as stream:
+            line = stream.readline()
+
+    if not line:
+        raise ConnectionError("Publish worker closed connection.")
+    return json.loads(line.decode("utf-8"))
+
+
+def print_publish_job_result(result, stream=None):
+    """Print records of publish job result.
+
+    Args:
+        result (dict[str, Any]): Result from 'submit_publish_job'.
+        stream (Optional[TextIO]): Output stream, stdout by default.
+
+    """
+    if stream is None:
+        stream = sys.stdout
+    for item in result["results"]:
+        label = item["plugin"]
+        if item["instance"]:
+            label += " ({})".format(item["instance"])
+        stream.write("{}\n".format(label))
+        for record in item["records"]:
+            stream.write("    {}\n".format(record))
+
+    if result["error"]:
+        stream.write("{}\n".format(result["error"]))
@@ -4,7 +4,7 @@ Temporary folder operations
 
 import os
 from ayon_core.lib import StringTemplate
-from ayon_core.pipeline import Anatomy
+from ayon_core.pipeline import get_shared_anatomy
 
 
 def create_custom_tempdir(project_name, anatomy=None):
@@ -36,7 +36,7 @@ def create_custom_tempdir(project_name, anatomy=None):
     custom_tempdir = None
     if "{" in env_tmpdir:
         if anatomy is None:
-            anatomy = Anatomy(project_name)
+            anatomy = get_shared_anatomy(project_name)
         # create base formate data
         data = {
             "root": anatomy.roots,
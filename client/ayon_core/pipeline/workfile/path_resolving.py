@@ -11,7 +11,11 @@ from ayon_core.lib import (
     Logger,
     StringTemplate,
 )
-from ayon_core.pipeline import version_start, Anatomy
+from ayon_core.pipeline import (
+    version_start,
+    Anatomy,
+    get_shared_anatomy,
+)
 from ayon_core.pipeline.template_data import get_template_data
 
 
@@ -125,7 +129,7 @@ def get_workdir_with_workdir_data(
     """
 
     if not anatomy:
-        anatomy = Anatomy(project_name)
+        anatomy = get_shared_anatomy(project_name)
 
     if not template_key:
         template_key = get_workfile_template_key(
@@ -420,7 +424,7 @@ def get_custom_workfile_template(
         return
 
     if anatomy is None:
-        anatomy = Anatomy(project_name)
+        anatomy = get_shared_anatomy(project_name)
 
     # get project, folder, task anatomy context data
     anatomy_context_data = get_template_data(
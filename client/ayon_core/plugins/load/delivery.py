@@ -13,7 +13,10 @@ from ayon_core.lib import (
     collect_frames,
     get_datetime_data,
 )
-from ayon_core.pipeline.load import get_representation_path_with_anatomy
+from ayon_core.pipeline.load import (
+    get_representation_path_with_anatomy,
+    get_representations_files,
+)
 from ayon_core.pipeline.delivery import (
     get_format_dict,
     check_destination_path,
@@ -309,6 +312,14 @@ class DeliveryOptionsDialog(QtWidgets.QDialog):
         repres = list(ayon_api.get_representations(
             project_name, version_ids=version_ids
         ))
+        # Resolve version resource files stored on version
+        files_by_repre_id = get_representations_files(
+            project_name,
+            repres,
+            [context["version"] for context in contexts]
+        )
+        for repre in repres:
+            repre["files"] = files_by_repre_id[repre["id"]]
 
         self._representations = repres
 
@@ -0,0 +1,18 @@
+import pyblish.api
+
+
+class CollectExtractionOffload(pyblish.api.ContextPlugin):
+    """Enable hand over of extraction commands to tray extraction service.
+
+    Extract plugins using 'submit_extraction_job' then don't wait for
+    commands to finish, integration waits for them instead.
+    """
+
+    order = pyblish.api.CollectorOrder
+    label = "Collect Extraction Offload"
+    targets = ["local"]
+
+    enabled = False
+
+    def process(self, context):
+        context.data["offloadExtraction"] = True
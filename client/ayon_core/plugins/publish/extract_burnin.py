@@ -86,6 +86,11 @@ class ExtractBurnin(publish.Extractor):
                 "Instance does not have filled representations. Skipping")
             return
 
+        # Files of representations may be created by extraction jobs
+        publish.wait_for_representations_extraction_jobs(
+            instance.data["representations"], logger=self.log
+        )
+
         self.main_process(instance)
 
         # Remove only representation tagged with both
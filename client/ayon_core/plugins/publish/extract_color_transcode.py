@@ -10,7 +10,7 @@ from ayon_core.lib import (
 )
 
 from ayon_core.lib.transcoding import (
-    convert_colorspace,
+    get_convert_colorspace_args,
     get_transcode_temp_directory,
 )
 
@@ -50,6 +50,10 @@ class ExtractOIIOTranscode(publish.Extractor):
     'colorspace' denotes target colorspace to be transcoded into. Could be
     empty if transcoding should be only into display and viewer colorspace.
     (In that case both 'display' and 'view' must be filled.)
+
+    Conversions are submitted as extraction job of the new representation,
+    when extraction offload is enabled they are processed by tray and
+    publishing continues.
     """
 
     label = "Transcode color spaces"
@@ -145,13 +149,14 @@ class ExtractOIIOTranscode(publish.Extractor):
 
                 files_to_convert = self._translate_to_sequence(
                     files_to_convert)
+                steps = []
                 for file_name in files_to_convert:
                     input_path = os.path.join(original_staging_dir,
                                               file_name)
                     output_path = self._get_output_file_path(input_path,
                                                              new_staging_dir,
                                                              output_extension)
-                    convert_colorspace(
+                    oiio_args = get_convert_colorspace_args(
                         input_path,
                         output_path,
                         config_path,
@@ -162,6 +167,24 @@ class ExtractOIIOTranscode(publish.Extractor):
                         additional_command_args,
                         self.log
                     )
+                    self.log.debug(
+                        "Conversion arguments: {}".format(" ".join(oiio_args))
+                    )
+                    steps.append({"tool": "oiiotool", "args": oiio_args})
+
+                publish.submit_extraction_job(
+                    instance,
+                    steps,
+                    outputs=[
+                        os.path.join(new_staging_dir, file_name)
+                        for file_name in new_repre["files"]
+                    ],
+                    label="{} {}".format(
+                        instance.data["productName"], new_repre["name"]
+                    ),
+                    representation=new_repre,
+                    logger=self.log
+                )
 
                 # cleanup temporary transcoded files
                 for file_name in new_repre["files"]:
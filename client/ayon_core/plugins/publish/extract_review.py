@@ -5,6 +5,7 @@ import json
 import shutil
 import subprocess
 from abc import ABCMeta, abstractmethod
+from concurrent.futures import ThreadPoolExecutor
 
 import six
 import clique
@@ -15,7 +16,7 @@ from ayon_core.lib import (
     get_ffmpeg_tool_args,
     filter_profiles,
     path_to_subprocess_arg,
-    run_subprocess,
+    get_process_scheduler,
 )
 from ayon_core.lib.transcoding import (
     IMAGE_EXTENSIONS,
@@ -28,6 +29,7 @@ from ayon_core.lib.transcoding import (
 from ayon_core.pipeline.publish import (
     KnownPublishError,
     get_publish_instance_label,
+    wait_for_representations_extraction_jobs,
 )
 from ayon_core.pipeline.publish.lib import add_repre_files_for_cleanup
 
@@ -105,12 +107,27 @@ class ExtractReview(pyblish.api.InstancePlugin):
     # Preset attributes
     profiles = []
 
+    # Maximum number of ffmpeg processes of the plugin running at the same
+    #   time
+    # - value '0' or lower leaves the limit on shared process scheduler
+    max_parallel_jobs = 0
+    # Cores used by one ffmpeg process in process scheduler budget
+    cores_per_job = 4
+    # Expected memory used by one ffmpeg process in MB in process scheduler
+    #   budget
+    memory_per_job_mb = 2048
+
     def process(self, instance):
         self.log.debug(str(instance.data["representations"]))
         # Skip review when requested.
         if not instance.data.get("review", True):
             return
 
+        # Files of representations may be created by extraction jobs
+        wait_for_representations_extraction_jobs(
+            instance.data["representations"], logger=self.log
+        )
+
         # Run processing
         self.main_process(instance)
 
@@ -256,88 +273,168 @@ class ExtractReview(pyblish.api.InstancePlugin):
             instance, profile_outputs
         )
 
-        for repre, output_defs in outputs_per_repres:
-            # Check if input should be preconverted before processing
-            # Store original staging dir (it's value may change)
-            src_repre_staging_dir = repre["stagingDir"]
-            # Receive filepath to first file in representation
-            first_input_path = None
-            input_filepaths = []
-            if not self.input_is_sequence(repre):
-                first_input_path = os.path.join(
-                    src_repre_staging_dir, repre["files"]
+        # Prepare ffmpeg jobs of all representations and output definitions
+        #   and run them at once
+        jobs = []
+        temp_staging_dirs = []
+        try:
+            for repre, output_defs in outputs_per_repres:
+                self._prepare_representation_jobs(
+                    instance, repre, output_defs, jobs, temp_staging_dirs
                 )
-                input_filepaths.append(first_input_path)
-            else:
-                for filename in repre["files"]:
-                    filepath = os.path.join(
-                        src_repre_staging_dir, filename
-                    )
-                    input_filepaths.append(filepath)
-                    if first_input_path is None:
-                        first_input_path = filepath
 
-            filtered_output_defs = self._single_frame_filter(
-                input_filepaths, output_defs
+            self._run_jobs(jobs)
+
+        finally:
+            # Make sure filled gaps and temporary staging are cleaned up
+            files_to_clean = set()
+            for job in jobs:
+                files_to_clean |= set(job["files_to_clean"])
+            for filepath in files_to_clean:
+                if os.path.exists(filepath):
+                    os.unlink(filepath)
+
+            for new_staging_dir in temp_staging_dirs:
+                if os.path.exists(new_staging_dir):
+                    shutil.rmtree(new_staging_dir)
+
+        # Add new representations in order of preparation
+        for job in jobs:
+            new_repre = job["new_repre"]
+            self.log.debug(
+                "Adding new representation: {}".format(new_repre)
             )
-            if not filtered_output_defs:
-                self.log.debug((
-                    "Repre: {} - All output definitions were filtered"
-                    " out by single frame filter. Skipping"
-                ).format(repre["name"]))
-                continue
+            instance.data["representations"].append(new_repre)
 
-            # Skip if file is not set
-            if first_input_path is None:
-                self.log.warning((
-                    "Representation \"{}\" have empty files. Skipped."
-                ).format(repre["name"]))
-                continue
+            add_repre_files_for_cleanup(instance, new_repre)
 
-            # Determine if representation requires pre conversion for ffmpeg
-            do_convert = should_convert_for_ffmpeg(first_input_path)
-            # If result is None the requirement of conversion can't be
-            #   determined
-            if do_convert is None:
-                self.log.info((
-                    "Can't determine if representation requires conversion."
-                    " Skipped."
-                ))
-                continue
+    def _prepare_representation_jobs(
+        self, instance, repre, output_defs, jobs, temp_staging_dirs
+    ):
+        # Check if input should be preconverted before processing
+        # Store original staging dir (it's value may change)
+        src_repre_staging_dir = repre["stagingDir"]
+        # Receive filepath to first file in representation
+        first_input_path = None
+        input_filepaths = []
+        if not self.input_is_sequence(repre):
+            first_input_path = os.path.join(
+                src_repre_staging_dir, repre["files"]
+            )
+            input_filepaths.append(first_input_path)
+        else:
+            for filename in repre["files"]:
+                filepath = os.path.join(
+                    src_repre_staging_dir, filename
+                )
+                input_filepaths.append(filepath)
+                if first_input_path is None:
+                    first_input_path = filepath
 
-            layer_name = get_review_layer_name(first_input_path)
+        filtered_output_defs = self._single_frame_filter(
+            input_filepaths, output_defs
+        )
+        if not filtered_output_defs:
+            self.log.debug((
+                "Repre: {} - All output definitions were filtered"
+                " out by single frame filter. Skipping"
+            ).format(repre["name"]))
+            return
 
-            # Do conversion if needed
-            #   - change staging dir of source representation
-            #   - must be set back after output definitions processing
-            if do_convert:
-                new_staging_dir = get_transcode_temp_directory()
-                repre["stagingDir"] = new_staging_dir
+        # Skip if file is not set
+        if first_input_path is None:
+            self.log.warning((
+                "Representation \"{}\" have empty files. Skipped."
+            ).format(repre["name"]))
+            return
+
+        # Determine if representation requires pre conversion for ffmpeg
+        do_convert = should_convert_for_ffmpeg(first_input_path)
+        # If result is None the requirement of conversion can't be
+        #   determined
+        if do_convert is None:
+            self.log.info((
+                "Can't determine if representation requires conversion."
+                " Skipped."
+            ))
+            return
+
+        layer_name = get_review_layer_name(first_input_path)
 
+        # Do conversion if needed
+        #   - change staging dir of source representation
+        #   - must be set back after output definitions processing
+        if do_convert:
+            new_staging_dir = get_transcode_temp_directory()
+            temp_staging_dirs.append(new_staging_dir)
+            repre["stagingDir"] = new_staging_dir
+
+        try:
+            if do_convert:
                 convert_input_paths_for_ffmpeg(
                     input_filepaths,
                     new_staging_dir,
                     self.log
                 )
 
-            try:
-                self._render_output_definitions(
-                    instance,
-                    repre,
-                    src_repre_staging_dir,
-                    filtered_output_defs,
-                    layer_name
+            jobs.extend(self._render_output_definitions(
+                instance,
+                repre,
+                src_repre_staging_dir,
+                filtered_output_defs,
+                layer_name
+            ))
+
+        finally:
+            # Set staging dir of source representation back to previous
+            #   value
+            # - temporary staging is removed after all jobs are processed
+            if do_convert:
+                repre["stagingDir"] = src_repre_staging_dir
+
+    def _run_jobs(self, jobs):
+        """Run prepared ffmpeg jobs using shared process scheduler.
+
+        All jobs are finished before error of first failed job is raised.
+
+        Args:
+            jobs (list[dict[str, Any]]): Prepared jobs.
+
+        """
+        scheduler = get_process_scheduler()
+        submit_kwargs = {
+            "cores": self.cores_per_job,
+            "memory_mb": self.memory_per_job_mb,
+            "shell": True,
+            "logger": self.log,
+        }
+        if self.max_parallel_jobs <= 0:
+            process_jobs = []
+            for job in jobs:
+                subprcs_cmd = job["subprocess_cmd"]
+                self.log.debug("Executing: {}".format(subprcs_cmd))
+                process_jobs.append(
+                    scheduler.submit(subprcs_cmd, **submit_kwargs)
                 )
+            scheduler.wait(process_jobs)
+            return
 
-            finally:
-                # Make sure temporary staging is cleaned up and representation
-                #   has set origin stagingDir
-                if do_convert:
-                    # Set staging dir of source representation back to previous
-                    #   value
-                    repre["stagingDir"] = src_repre_staging_dir
-                    if os.path.exists(new_staging_dir):
-                        shutil.rmtree(new_staging_dir)
+        # Limit of the plugin is applied on top of scheduler budget
+        def _run_job(job):
+            subprcs_cmd = job["subprocess_cmd"]
+            self.log.debug("Executing: {}".format(subprcs_cmd))
+            scheduler.run(subprcs_cmd, **submit_kwargs)
+
+        max_workers = min(self.max_parallel_jobs, len(jobs))
+        with ThreadPoolExecutor(max_workers=max_workers) as executor:
+            futures = [
+                executor.submit(_run_job, job)
+                for job in jobs
+            ]
+        for future in futures:
+            exc = future.exception()
+            if exc is not None:
+                raise exc
 
     def _render_output_definitions(
         self,
@@ -347,6 +444,14 @@ class ExtractReview(pyblish.api.InstancePlugin):
         output_definitions,
         layer_name
     ):
+        """Prepare ffmpeg jobs for output definitions of representation.
+
+        Returns:
+            list[dict[str, Any]]: Jobs with ffmpeg command, new
+                representation and files to clean after processing.
+
+        """
+        jobs = []
         fill_data = copy.deepcopy(instance.data["anatomyData"])
         for _output_def in output_definitions:
             output_def = copy.deepcopy(_output_def)
@@ -451,21 +556,11 @@ class ExtractReview(pyblish.api.InstancePlugin):
                         ),
                         exc_info=True
                     )
-                    return
+                    return jobs
                 raise NotImplementedError
 
             subprcs_cmd = " ".join(ffmpeg_args)
 
-            # run subprocess
-            self.log.debug("Executing: {}".format(subprcs_cmd))
-
-            run_subprocess(subprcs_cmd, shell=True, logger=self.log)
-
-            # delete files added to fill gaps
-            if files_to_clean:
-                for f in files_to_clean:
-                    os.unlink(f)
-
             new_repre.update({
                 "fps": temp_data["fps"],
                 "name": "{}_{}".format(output_name, output_ext),
@@ -481,13 +576,13 @@ class ExtractReview(pyblish.api.InstancePlugin):
             if "clean_name" in new_repre.get("tags", []):
                 new_repre.pop("outputName")
 
-            # adding representation
-            self.log.debug(
-                "Adding new representation: {}".format(new_repre)
-            )
-            instance.data["representations"].append(new_repre)
+            jobs.append({
+                "subprocess_cmd": subprcs_cmd,
+                "new_repre": new_repre,
+                "files_to_clean": files_to_clean,
+            })
 
-            add_repre_files_for_cleanup(instance, new_repre)
+        return jobs
 
     def input_is_sequence(self, repre):
         """Deduce from representation data if input is sequence."""
@@ -33,11 +33,40 @@ class ExtractReviewSlate(publish.Extractor):
     hosts = ["nuke", "shell"]
     optional = True
 
+    # Join slate and review with concat demuxer and stream copy when slate
+    #   is encoded with same stream parameters as the review. Review is then
+    #   not decoded and encoded again. Concat filter is used as fallback.
+    use_stream_copy_concat = True
+
+    # Stream keys that must match to be able to concatenate using stream copy
+    video_concat_keys = (
+        "codec_name",
+        "profile",
+        "pix_fmt",
+        "width",
+        "height",
+        "sample_aspect_ratio",
+        "r_frame_rate",
+        "level",
+        "time_base",
+    )
+    audio_concat_keys = (
+        "codec_name",
+        "sample_rate",
+        "channels",
+        "channel_layout",
+    )
+
     def process(self, instance):
         inst_data = instance.data
         if "representations" not in inst_data:
             raise RuntimeError("Burnin needs already created mov to work on.")
 
+        # Files of representations may be created by extraction jobs
+        publish.wait_for_representations_extraction_jobs(
+            inst_data["representations"], logger=self.log
+        )
+
         # get slates frame from upstream
         slates_data = inst_data.get("slateFrames")
         if not slates_data:
@@ -297,66 +326,29 @@ class ExtractReviewSlate(publish.Extractor):
                 # replace slate with silent slate for concat
                 slate_v_path = slate_silent_path
 
-            # concat slate and videos together with concat filter
-            # this will reencode the output
-            if input_audio:
-                fmap = [
-                    "-filter_complex",
-                    "[0:v] [0:a] [1:v] [1:a] concat=n=2:v=1:a=1 [v] [a]",
-                    "-map", '[v]',
-                    "-map", '[a]'
-                ]
-            else:
-                fmap = [
-                    "-filter_complex",
-                    "[0:v] [1:v] concat=n=2:v=1:a=0 [v]",
-                    "-map", '[v]'
-                ]
-            concat_args = get_ffmpeg_tool_args(
-                "ffmpeg",
-                "-y",
-                "-i", slate_v_path,
-                "-i", input_path,
-            )
-            concat_args.extend(fmap)
-            if offset_timecode:
-                concat_args.extend(["-timecode", offset_timecode])
-            # NOTE: Added because of OP Atom demuxers
-            # Add format arguments if there are any
-            # - keep format of output
-            if format_args:
-                concat_args.extend(format_args)
-
-            if codec_args:
-                concat_args.extend(codec_args)
-
-            # Use arguments from ffmpeg preset
-            source_ffmpeg_cmd = repre.get("ffmpeg_cmd")
-            if source_ffmpeg_cmd:
-                copy_args = (
-                    "-metadata",
-                    "-metadata:s:v:0",
-                    "-b:v",
-                    "-b:a",
+            concatenated = False
+            if self.use_stream_copy_concat and not use_legacy_code:
+                concatenated = self._concat_with_stream_copy(
+                    slate_v_path,
+                    input_path,
+                    output_path,
+                    streams,
+                    offset_timecode,
+                    format_args,
+                    repre.get("ffmpeg_cmd")
                 )
-                args = source_ffmpeg_cmd.split(" ")
-                for indx, arg in enumerate(args):
-                    if arg in copy_args:
-                        concat_args.append(arg)
-                        # assumes arg has one parameter
-                        concat_args.append(args[indx + 1])
-
-            # add final output path
-            concat_args.append(output_path)
 
-            # ffmpeg concat subprocess
-            self.log.debug(
-                "Executing concat filter: {}".format
-                (" ".join(concat_args))
-            )
-            run_subprocess(
-                concat_args, logger=self.log
-            )
+            if not concatenated:
+                self._concat_with_filter(
+                    slate_v_path,
+                    input_path,
+                    output_path,
+                    input_audio,
+                    offset_timecode,
+                    format_args,
+                    codec_args,
+                    repre.get("ffmpeg_cmd")
+                )
 
             self.log.debug("__ repre[tags]: {}".format(repre["tags"]))
             repre_update = {
@@ -386,6 +378,228 @@ class ExtractReviewSlate(publish.Extractor):
 
         self.log.debug(inst_data["representations"])
 
+    def _concat_with_filter(
+        self,
+        slate_v_path,
+        input_path,
+        output_path,
+        input_audio,
+        offset_timecode,
+        format_args,
+        codec_args,
+        source_ffmpeg_cmd
+    ):
+        # concat slate and videos together with concat filter
+        # this will reencode the output
+        if input_audio:
+            fmap = [
+                "-filter_complex",
+                "[0:v] [0:a] [1:v] [1:a] concat=n=2:v=1:a=1 [v] [a]",
+                "-map", '[v]',
+                "-map", '[a]'
+            ]
+        else:
+            fmap = [
+                "-filter_complex",
+                "[0:v] [1:v] concat=n=2:v=1:a=0 [v]",
+                "-map", '[v]'
+            ]
+        concat_args = get_ffmpeg_tool_args(
+            "ffmpeg",
+            "-y",
+            "-i", slate_v_path,
+            "-i", input_path,
+        )
+        concat_args.extend(fmap)
+        if offset_timecode:
+            concat_args.extend(["-timecode", offset_timecode])
+        # NOTE: Added because of OP Atom demuxers
+        # Add format arguments if there are any
+        # - keep format of output
+        if format_args:
+            concat_args.extend(format_args)
+
+        if codec_args:
+            concat_args.extend(codec_args)
+
+        # Use arguments from ffmpeg preset
+        concat_args.extend(self._get_source_ffmpeg_args(
+            source_ffmpeg_cmd,
+            (
+                "-metadata",
+                "-metadata:s:v:0",
+                "-b:v",
+                "-b:a",
+            )
+        ))
+
+        # add final output path
+        concat_args.append(output_path)
+
+        # ffmpeg concat subprocess
+        self.log.debug(
+            "Executing concat filter: {}".format
+            (" ".join(concat_args))
+        )
+        run_subprocess(
+            concat_args, logger=self.log
+        )
+
+    def _concat_with_stream_copy(
+        self,
+        slate_v_path,
+        input_path,
+        output_path,
+        input_streams,
+        offset_timecode,
+        format_args,
+        source_ffmpeg_cmd
+    ):
+        """Concatenate slate and review using concat demuxer.
+
+        Streams are copied without re-encoding. That is possible only if
+        slate was encoded with same stream parameters as the review. Codec
+        arguments are not used because streams are not encoded, slate was
+        already encoded with them.
+
+        Args:
+            slate_v_path (str): Path to encoded slate video.
+            input_path (str): Path to review video.
+            output_path (str): Output path.
+            input_streams (list[dict[str, Any]]): FFprobe streams of review.
+            offset_timecode (str): Timecode of output.
+            format_args (list[str]): Output format arguments.
+            source_ffmpeg_cmd (Optional[str]): Ffmpeg command which created
+                the review. Metadata arguments are copied from it.
+
+        Returns:
+            bool: Concatenation was successful. Concat filter should be
+                used if is 'False'.
+
+        """
+        slate_streams = get_ffprobe_streams(slate_v_path, self.log)
+        if not self._are_streams_concat_compatible(
+            slate_streams, input_streams
+        ):
+            self.log.debug(
+                "Slate streams don't match review streams."
+                " Using concat filter."
+            )
+            return False
+
+        concat_list_path = "{}_concat.txt".format(
+            os.path.splitext(output_path)[0]
+        )
+        with open(concat_list_path, "w") as stream:
+            for path in (slate_v_path, input_path):
+                # Escape single quotes for concat demuxer
+                stream.write("file '{}'\n".format(
+                    path.replace("\\", "/").replace("'", "'\\''")
+                ))
+
+        concat_args = get_ffmpeg_tool_args(
+            "ffmpeg",
+            "-y",
+            "-f", "concat",
+            "-safe", "0",
+            "-i", concat_list_path,
+            "-map", "0:v",
+            "-map", "0:a?",
+            "-c", "copy",
+        )
+        if offset_timecode:
+            concat_args.extend(["-timecode", offset_timecode])
+        # Keep format of output (e.g. OP Atom)
+        if format_args:
+            concat_args.extend(format_args)
+        concat_args.extend(self._get_source_ffmpeg_args(
+            source_ffmpeg_cmd, ("-metadata", "-metadata:s:v:0")
+        ))
+        concat_args.append(output_path)
+
+        self.log.debug(
+            "Executing concat demuxer: {}".format(" ".join(concat_args))
+        )
+        try:
+            run_subprocess(concat_args, logger=self.log)
+        except Exception:
+            self.log.warning(
+                "Concat with stream copy failed. Using concat filter.",
+                exc_info=True
+            )
+            return False
+        finally:
+            os.remove(concat_list_path)
+        return True
+
+    def _get_source_ffmpeg_args(self, source_ffmpeg_cmd, copy_args):
+        """Arguments with their values copied from source ffmpeg command.
+
+        Args:
+            source_ffmpeg_cmd (Optional[str]): Ffmpeg command.
+            copy_args (Iterable[str]): Arguments to copy.
+
+        Returns:
+            list[str]: Copied arguments with values.
+
+        """
+        output = []
+        if not source_ffmpeg_cmd:
+            return output
+
+        args = source_ffmpeg_cmd.split(" ")
+        for indx, arg in enumerate(args):
+            if arg in copy_args:
+                output.append(arg)
+                # assumes arg has one parameter
+                output.append(args[indx + 1])
+        return output
+
+    def _are_streams_concat_compatible(self, slate_streams, input_streams):
+        """Check if slate streams can be joined with review streams.
+
+        Args:
+            slate_streams (list[dict[str, Any]]): FFprobe streams of slate.
+            input_streams (list[dict[str, Any]]): FFprobe streams of review.
+
+        Returns:
+            bool: Streams have matching parameters.
+
+        """
+        keys_by_codec_type = {
+            "video": self.video_concat_keys,
+            "audio": self.audio_concat_keys,
+        }
+        # Data streams (e.g. timecode) are not copied
+        slate_streams = [
+            stream
+            for stream in slate_streams
+            if stream.get("codec_type") in keys_by_codec_type
+        ]
+        input_streams = [
+            stream
+            for stream in input_streams
+            if stream.get("codec_type") in keys_by_codec_type
+        ]
+        if len(slate_streams) != len(input_streams):
+            return False
+
+        for slate_stream, input_stream in zip(slate_streams, input_streams):
+            codec_type = input_stream.get("codec_type")
+            if slate_stream.get("codec_type") != codec_type:
+                return False
+
+            keys = keys_by_codec_type[codec_type]
+            for key in keys:
+                if slate_stream.get(key) != input_stream.get(key):
+                    self.log.debug(
+                        "Stream '{}' value differs: {} != {}".format(
+                            key, slate_stream.get(key), input_stream.get(key)
+                        )
+                    )
+                    return False
+        return True
+
     def _get_slate_path(self, input_file, slates_data):
         slate_path = None
         for sl_n, _slate_path in slates_data.items():
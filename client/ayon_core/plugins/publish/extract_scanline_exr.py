@@ -6,7 +6,7 @@ import shutil
 import pyblish.api
 
 from ayon_core.lib import (
-    run_subprocess,
+    get_process_scheduler,
     get_oiio_tool_args,
     ToolNotFoundError,
 )
@@ -56,6 +56,9 @@ class ExtractScanlineExr(pyblish.api.InstancePlugin):
                 self.log.error("OIIO tool not found.")
                 raise KnownPublishError("OIIO tool not found")
 
+            scheduler = get_process_scheduler()
+            process_jobs = []
+            converted_files = []
             for file in input_files:
 
                 original_name = os.path.join(stagingdir, file)
@@ -69,8 +72,14 @@ class ExtractScanlineExr(pyblish.api.InstancePlugin):
 
                 subprocess_exr = " ".join(oiio_cmd)
                 self.log.debug(f"running: {subprocess_exr}")
-                run_subprocess(subprocess_exr, logger=self.log)
+                process_jobs.append(
+                    scheduler.submit(subprocess_exr, logger=self.log)
+                )
+                converted_files.append((original_name, temp_name))
 
+            scheduler.wait(process_jobs)
+
+            for original_name, temp_name in converted_files:
                 # raise error if there is no ouptput
                 if not os.path.exists(os.path.join(stagingdir, original_name)):
                     self.log.error(
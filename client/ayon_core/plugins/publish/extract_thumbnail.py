@@ -18,6 +18,9 @@ from ayon_core.lib import (
 from ayon_core.lib.transcoding import convert_colorspace
 
 from ayon_core.lib.transcoding import VIDEO_EXTENSIONS
+from ayon_core.pipeline.publish import (
+    wait_for_representations_extraction_jobs,
+)
 
 
 class ExtractThumbnail(pyblish.api.InstancePlugin):
@@ -66,6 +69,11 @@ class ExtractThumbnail(pyblish.api.InstancePlugin):
     product_names = []
 
     def process(self, instance):
+        # Files of representations may be created by extraction jobs
+        wait_for_representations_extraction_jobs(
+            instance.data.get("representations") or [], logger=self.log
+        )
+
         # run main process
         self._main_process(instance)
 
@@ -2,6 +2,8 @@ import os
 import logging
 import sys
 import copy
+import collections
+from concurrent.futures import ThreadPoolExecutor
 
 import clique
 import six
@@ -9,7 +11,9 @@ import pyblish.api
 from ayon_api import (
     get_attributes_for_type,
     get_product_by_name,
+    get_products,
     get_version_by_name,
+    get_versions,
     get_representations,
 )
 from ayon_api.operations import (
@@ -25,6 +29,7 @@ from ayon_core.lib.file_transaction import (
     FileTransaction,
     DuplicateDestinationError
 )
+from ayon_core.pipeline import VERSION_RESOURCE_FILES_KEY
 from ayon_core.pipeline.publish import (
     KnownPublishError,
     get_publish_template_name,
@@ -83,6 +88,15 @@ def get_frame_padded(frame, padding):
     return "{frame:0{padding}d}".format(padding=padding, frame=frame)
 
 
+class _PrefetchedEntities:
+    """Existing entities of instance queried for all instances at once."""
+
+    def __init__(self, product_entity, version_entity):
+        self.product_entity = product_entity
+        self.version_entity = version_entity
+        self.representations = []
+
+
 class IntegrateAsset(pyblish.api.InstancePlugin):
     """Register publish in the database and transfer files to destinations.
 
@@ -111,6 +125,16 @@ class IntegrateAsset(pyblish.api.InstancePlugin):
 
     default_template_name = "publish"
 
+    # Number of threads used to transfer files and to collect published
+    #   files information. Network storages benefit from multiple
+    #   operations in flight.
+    max_transfer_workers = 8
+
+    # Store version resource files (e.g. textures of a look) once on version
+    #   data instead of adding them to 'files' of each representation.
+    # - consumers should use 'get_representations_files' to resolve them
+    store_resources_on_version = False
+
     # Representation context keys that should always be written to
     # the database even if not used by the destination template
     db_representation_context_keys = [
@@ -151,11 +175,20 @@ class IntegrateAsset(pyblish.api.InstancePlugin):
             ).format(instance.data["productType"]))
             return
 
-        file_transactions = FileTransaction(log=self.log,
-                                            # Enforce unique transfers
-                                            allow_queue_replacements=False)
+        prefetched = self._get_prefetched_entities(instance.context).pop(
+            instance.id, None
+        )
+
+        file_transactions = FileTransaction(
+            log=self.log,
+            # Enforce unique transfers
+            allow_queue_replacements=False,
+            max_workers=self.max_transfer_workers
+        )
         try:
-            self.register(instance, file_transactions, filtered_repres)
+            self.register(
+                instance, file_transactions, filtered_repres, prefetched
+            )
         except DuplicateDestinationError as exc:
             # Raise DuplicateDestinationError as KnownPublishError
             # and rollback the transactions
@@ -174,6 +207,119 @@ class IntegrateAsset(pyblish.api.InstancePlugin):
         # the try, except.
         file_transactions.finalize()
 
+    def _get_prefetched_entities(self, context):
+        """Existing entities of all integrated instances of context.
+
+        Existing products, versions and representations are queried at
+        once on first call instead of separate queries for each instance.
+        Entities are still written per instance. Instances publishing the
+        same product as other instance query entities on their own.
+
+        Returns:
+            dict[str, _PrefetchedEntities]: Prefetched entities by
+                instance id. Items are removed when used.
+
+        """
+        prefetched_by_id = context.data.get("integrateAssetPrefetched")
+        if prefetched_by_id is None:
+            prefetched_by_id = self._prefetch_entities(context)
+            context.data["integrateAssetPrefetched"] = prefetched_by_id
+        return prefetched_by_id
+
+    def _is_prefetch_instance(self, instance):
+        if (
+            instance.data.get("publish") is False
+            or instance.data.get("active") is False
+            or instance.data.get("farm")
+            or not instance.data.get("integrate", True)
+        ):
+            return False
+
+        try:
+            return bool(self.filter_representations(instance))
+        except Exception:
+            # Error is raised during integration of the instance
+            return False
+
+    def _prefetch_entities(self, context):
+        project_name = context.data["projectName"]
+        instances = []
+        names_by_folder_ids = collections.defaultdict(set)
+        used_keys = set()
+        for instance in context:
+            if not self._is_prefetch_instance(instance):
+                continue
+            folder_entity = instance.data.get("folderEntity")
+            product_name = instance.data.get("productName")
+            if (
+                not folder_entity
+                or not product_name
+                or instance.data.get("version") is None
+            ):
+                continue
+            key = (folder_entity["id"], product_name)
+            if key in used_keys:
+                continue
+            used_keys.add(key)
+            names_by_folder_ids[folder_entity["id"]].add(product_name)
+            instances.append(instance)
+
+        if not instances:
+            return {}
+
+        products_by_key = {
+            (product_entity["folderId"], product_entity["name"]):
+                product_entity
+            for product_entity in get_products(
+                project_name, names_by_folder_ids=names_by_folder_ids
+            )
+        }
+        versions_by_key = {}
+        if products_by_key:
+            versions_by_key = {
+                (version_entity["productId"], version_entity["version"]):
+                    version_entity
+                for version_entity in get_versions(
+                    project_name,
+                    product_ids={
+                        product_entity["id"]
+                        for product_entity in products_by_key.values()
+                    },
+                    versions={
+                        instance.data["version"]
+                        for instance in instances
+                    },
+                    hero=False
+                )
+            }
+
+        prefetched_by_id = {}
+        prefetched_by_version_id = {}
+        for instance in instances:
+            product_entity = products_by_key.get((
+                instance.data["folderEntity"]["id"],
+                instance.data["productName"]
+            ))
+            version_entity = None
+            if product_entity is not None:
+                version_entity = versions_by_key.get(
+                    (product_entity["id"], instance.data["version"])
+                )
+            prefetched = _PrefetchedEntities(product_entity, version_entity)
+            prefetched_by_id[instance.id] = prefetched
+            if version_entity is not None:
+                prefetched_by_version_id[version_entity["id"]] = prefetched
+
+        if prefetched_by_version_id:
+            for repre_entity in get_representations(
+                project_name, version_ids=set(prefetched_by_version_id)
+            ):
+                prefetched = prefetched_by_version_id[
+                    repre_entity["versionId"]
+                ]
+                prefetched.representations.append(repre_entity)
+        return prefetched_by_id
+
     def filter_representations(self, instance):
         # Prepare repsentations that should be integrated
         repres = instance.data.get("representations")
@@ -202,7 +348,9 @@ class IntegrateAsset(pyblish.api.InstancePlugin):
 
         return filtered_repres
 
-    def register(self, instance, file_transactions, filtered_repres):
+    def register(
+        self, instance, file_transactions, filtered_repres, prefetched=None
+    ):
         project_name = instance.context.data["projectName"]
 
         instance_stagingdir = instance.data.get("stagingDir")
@@ -221,23 +369,40 @@ class IntegrateAsset(pyblish.api.InstancePlugin):
         template_name = self.get_template_name(instance)
 
         op_session = OperationsSession()
-        product_entity = self.prepare_product(
-            instance, op_session, project_name
-        )
-        version_entity = self.prepare_version(
-            instance, op_session, product_entity, project_name
-        )
+        if prefetched is None:
+            product_entity = self.prepare_product(
+                instance, op_session, project_name
+            )
+            version_entity = self.prepare_version(
+                instance, op_session, product_entity, project_name
+            )
+            # Get existing representations (if any)
+            existing_repre_entities = get_representations(
+                project_name,
+                version_ids=[version_entity["id"]]
+            )
+        else:
+            product_entity = self._prepare_product(
+                instance,
+                op_session,
+                project_name,
+                prefetched.product_entity
+            )
+            version_entity = self._prepare_version(
+                instance,
+                op_session,
+                product_entity,
+                project_name,
+                prefetched.version_entity
+            )
+            existing_repre_entities = prefetched.representations
         instance.data["versionEntity"] = version_entity
 
         anatomy = instance.context.data["anatomy"]
 
-        # Get existing representations (if any)
         existing_repres_by_name = {
             repre_entity["name"].lower(): repre_entity
-            for repre_entity in get_representations(
-                project_name,
-                version_ids=[version_entity["id"]]
-            )
+            for repre_entity in existing_repre_entities
         }
 
         # Prepare all representations
@@ -298,21 +463,47 @@ class IntegrateAsset(pyblish.api.InstancePlugin):
         # Compute the resource file infos once (files belonging to the
         # version instance instead of an individual representation) so
         # we can reuse those file infos per representation
-        resource_file_infos = self.get_files_info(
-            resource_destinations, anatomy
-        )
+        # - all destinations are processed in one pass to run the
+        #   filesystem queries in parallel
+        repre_destinations = [
+            [dst for _, dst in prepared["transfers"]]
+            for prepared in prepared_representations
+        ]
+        all_destinations = list(resource_destinations)
+        for destinations in repre_destinations:
+            all_destinations.extend(destinations)
+        file_info_by_path = dict(zip(
+            all_destinations,
+            self.get_files_info(all_destinations, anatomy)
+        ))
+        resource_file_infos = [
+            file_info_by_path[path]
+            for path in resource_destinations
+        ]
+        if self.store_resources_on_version and resource_file_infos:
+            version_data = version_entity["data"]
+            version_data[VERSION_RESOURCE_FILES_KEY] = resource_file_infos
+            op_session.update_entity(
+                project_name,
+                "version",
+                version_entity["id"],
+                {"data": version_data}
+            )
+            # Representations contain only their own files
+            resource_file_infos = []
 
         # Finalize the representations now the published files are integrated
         # Get 'files' info for representations and its attached resources
         new_repre_names_low = set()
-        for prepared in prepared_representations:
+        for prepared, destinations in zip(
+            prepared_representations, repre_destinations
+        ):
             repre_entity = prepared["representation"]
             repre_update_data = prepared["repre_update_data"]
-            transfers = prepared["transfers"]
-            destinations = [dst for src, dst in transfers]
-            repre_files = self.get_files_info(
-                destinations, anatomy
-            )
+            repre_files = [
+                copy.deepcopy(file_info_by_path[path])
+                for path in destinations
+            ]
             # Add the version resource file infos to each representation
             repre_files += resource_file_infos
             repre_entity["files"] = repre_files
@@ -368,13 +559,22 @@ class IntegrateAsset(pyblish.api.InstancePlugin):
     def prepare_product(self, instance, op_session, project_name):
         folder_entity = instance.data["folderEntity"]
         product_name = instance.data["productName"]
-        product_type = instance.data["productType"]
-        self.log.debug("Product: {}".format(product_name))
 
         # Get existing product if it exists
         existing_product_entity = get_product_by_name(
             project_name, product_name, folder_entity["id"]
         )
+        return self._prepare_product(
+            instance, op_session, project_name, existing_product_entity
+        )
+
+    def _prepare_product(
+        self, instance, op_session, project_name, existing_product_entity
+    ):
+        folder_entity = instance.data["folderEntity"]
+        product_name = instance.data["productName"]
+        product_type = instance.data["productType"]
+        self.log.debug("Product: {}".format(product_name))
 
         # Define product data
         data = {
@@ -433,6 +633,27 @@ class IntegrateAsset(pyblish.api.InstancePlugin):
 
     def prepare_version(
         self, instance, op_session, product_entity, project_name
+    ):
+        existing_version = get_version_by_name(
+            project_name,
+            instance.data["version"],
+            product_entity["id"]
+        )
+        return self._prepare_version(
+            instance,
+            op_session,
+            product_entity,
+            project_name,
+            existing_version
+        )
+
+    def _prepare_version(
+        self,
+        instance,
+        op_session,
+        product_entity,
+        project_name,
+        existing_version
     ):
         version_number = instance.data["version"]
         task_id = None
@@ -440,11 +661,6 @@ class IntegrateAsset(pyblish.api.InstancePlugin):
         if task_entity:
             task_id = task_entity["id"]
 
-        existing_version = get_version_by_name(
-            project_name,
-            version_number,
-            product_entity["id"]
-        )
         version_id = None
         if existing_version:
             version_id = existing_version["id"]
@@ -965,11 +1181,19 @@ class IntegrateAsset(pyblish.api.InstancePlugin):
             list[dict[str, Any]]: Representation 'files' information.
 
         """
-        file_infos = []
-        for filepath in filepaths:
-            file_info = self.prepare_file_info(filepath, anatomy)
-            file_infos.append(file_info)
-        return file_infos
+        filepaths = list(filepaths)
+        if self.max_transfer_workers <= 1 or len(filepaths) < 2:
+            return [
+                self.prepare_file_info(filepath, anatomy)
+                for filepath in filepaths
+            ]
+
+        max_workers = min(self.max_transfer_workers, len(filepaths))
+        with ThreadPoolExecutor(max_workers=max_workers) as executor:
+            return list(executor.map(
+                lambda filepath: self.prepare_file_info(filepath, anatomy),
+                filepaths
+            ))
 
     def prepare_file_info(self, path, anatomy):
         """ Prepare information for one file (asset or resource)
@@ -13,6 +13,7 @@ from ayon_api.operations import (
 from ayon_api.utils import create_entity_id
 
 from ayon_core.lib import create_hard_link, source_hash
+from ayon_core.pipeline import VERSION_RESOURCE_FILES_KEY
 from ayon_core.pipeline.publish import (
     get_publish_template_name,
     OptionalPyblishPluginMixin,
@@ -247,6 +248,11 @@ class IntegrateHeroVersion(
             attribs=copy.deepcopy(src_version_entity["attrib"]),
             entity_id=entity_id,
         )
+        # Resource files on version data point to files of source version
+        # - they're replaced with hero resource files once they're copied
+        src_resource_files = new_hero_version["data"].pop(
+            VERSION_RESOURCE_FILES_KEY, None
+        )
 
         if old_version:
             self.log.debug("Replacing old hero version.")
@@ -418,6 +424,20 @@ class IntegrateHeroVersion(
             for src_path, dst_path in other_file_paths_mapping:
                 self.copy_file(src_path, dst_path)
 
+            if src_resource_files:
+                resource_files = self.get_hero_resource_files(
+                    src_resource_files, other_file_paths_mapping, anatomy
+                )
+                new_hero_version["data"][VERSION_RESOURCE_FILES_KEY] = (
+                    resource_files
+                )
+                op_session.update_entity(
+                    project_name,
+                    "version",
+                    new_hero_version["id"],
+                    {"data": new_hero_version["data"]}
+                )
+
             # Update prepared representation etity data with files
             #   and integrate it to server.
             # NOTE: This must happen with existing files on disk because of
@@ -541,6 +561,40 @@ class IntegrateHeroVersion(
             "hash_type": "op3",
         }
 
+    def get_hero_resource_files(
+        self, src_resource_files, other_file_paths_mapping, anatomy
+    ):
+        """Prepare version resource files of hero version.
+
+        Arguments:
+            src_resource_files (list[dict[str, Any]]): Resource files stored
+                on source version.
+            other_file_paths_mapping (list[tuple[str, str]]): Copied files
+                from source version publish dir to hero publish dir.
+            anatomy (Anatomy): Project anatomy.
+
+        Returns:
+            list[dict[str, Any]]: Resource files information of hero files.
+
+        """
+        dst_path_by_src_path = {
+            os.path.normpath(src_path): dst_path
+            for src_path, dst_path in other_file_paths_mapping
+        }
+        dst_paths = []
+        for file_info in src_resource_files:
+            src_path = os.path.normpath(anatomy.fill_root(file_info["path"]))
+            dst_path = dst_path_by_src_path.get(src_path)
+            if dst_path is None:
+                self.log.debug(
+                    "Resource file was not copied to hero version: {}".format(
+                        src_path
+                    )
+                )
+                continue
+            dst_paths.append(dst_path)
+        return self.get_files_info(dst_paths, anatomy)
+
     def get_publish_dir(self, instance, template_key):
         anatomy = instance.context.data["anatomy"]
         template_data = copy.deepcopy(instance.data["anatomyData"])
@@ -0,0 +1,25 @@
+import pyblish.api
+
+from ayon_core.pipeline.publish import wait_for_extraction_jobs
+
+
+class WaitForExtractionJobs(pyblish.api.InstancePlugin):
+    """Wait for extraction jobs submitted to tray extraction service."""
+
+    order = pyblish.api.IntegratorOrder - 0.2
+    label = "Wait for Extraction Jobs"
+
+    # Maximum wait time in seconds, wait without limit if is 'None'
+    timeout = None
+
+    def process(self, instance):
+        job_ids = instance.data.get("extractionJobIds")
+        if not job_ids:
+            return
+
+        self.log.info(
+            "Waiting for {} extraction jobs".format(len(job_ids))
+        )
+        wait_for_extraction_jobs(
+            job_ids, timeout=self.timeout, logger=self.log
+        )
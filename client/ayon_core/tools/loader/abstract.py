@@ -993,6 +993,23 @@ class FrontendLoaderController(_BaseLoaderController):
 
         pass
 
+    @abstractmethod
+    def get_cached_version_sync_availability(self, project_name, version_ids):
+        """Version sync availability which does not require server query.
+
+        Versions without valid cache are not in output, they can be
+            received with 'get_version_sync_availability'.
+
+        Args:
+            project_name (str): Project name.
+            version_ids (Iterable[str]): Version ids.
+
+        Returns:
+            dict[str, tuple[int, int]]: Sync availability by version id.
+        """
+
+        pass
+
     @abstractmethod
     def get_representations_sync_status(
         self, project_name, representation_ids
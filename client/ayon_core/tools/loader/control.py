@@ -399,6 +399,11 @@ class LoaderController(BackendLoaderController, FrontendLoaderController):
             project_name, version_ids
         )
 
+    def get_cached_version_sync_availability(self, project_name, version_ids):
+        return self._sitesync_model.get_cached_version_sync_availability(
+            project_name, version_ids
+        )
+
     def get_representations_sync_status(
         self, project_name, representation_ids
     ):
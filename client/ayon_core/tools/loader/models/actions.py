@@ -6,7 +6,7 @@ import uuid
 
 import ayon_api
 
-from ayon_core.lib import NestedCacheItem
+from ayon_core.lib import NestedCacheItem, get_ayon_query_executor
 from ayon_core.pipeline.load import (
     discover_loader_plugins,
     ProductLoaderPlugin,
@@ -383,6 +383,13 @@ class LoaderActionsModel:
         if not project_name and not version_ids:
             return version_context_by_id, repre_context_by_id
 
+        # Project and representations do not depend on other queries
+        executor = get_ayon_query_executor()
+        project_future = executor.query("get_project", project_name)
+        repres_future = executor.query(
+            "get_representations", project_name, version_ids=version_ids
+        )
+
         version_entities = ayon_api.get_versions(
             project_name, version_ids=version_ids
         )
@@ -406,7 +413,7 @@ class LoaderActionsModel:
         )
         folder_entities_by_id = {f["id"]: f for f in _folder_entities}
 
-        project_entity = ayon_api.get_project(project_name)
+        project_entity = project_future.result()
 
         for version_id, version_entity in version_entities_by_id.items():
             product_id = version_entity["productId"]
@@ -420,9 +427,7 @@ class LoaderActionsModel:
                 "version": version_entity,
             }
 
-        repre_entities = ayon_api.get_representations(
-            project_name, version_ids=version_ids)
-        for repre_entity in repre_entities:
+        for repre_entity in repres_future.result():
             version_id = repre_entity["versionId"]
             version_entity = version_entities_by_id[version_id]
             product_id = version_entity["productId"]
@@ -464,6 +469,9 @@ class LoaderActionsModel:
         if not project_name and not repre_ids:
             return product_context_by_id, repre_context_by_id
 
+        project_future = get_ayon_query_executor().query(
+            "get_project", project_name
+        )
         repre_entities = list(ayon_api.get_representations(
             project_name, representation_ids=repre_ids
         ))
@@ -491,7 +499,7 @@ class LoaderActionsModel:
             f["id"]: f for f in folder_entities
         }
 
-        project_entity = ayon_api.get_project(project_name)
+        project_entity = project_future.result()
 
         for product_id, product_entity in product_entities_by_id.items():
             folder_id = product_entity["folderId"]
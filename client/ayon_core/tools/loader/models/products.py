@@ -5,7 +5,7 @@ import arrow
 import ayon_api
 from ayon_api.operations import OperationsSession
 
-from ayon_core.lib import NestedCacheItem
+from ayon_core.lib import NestedCacheItem, get_ayon_query_executor
 from ayon_core.style import get_default_entity_icon_color
 from ayon_core.tools.loader.abstract import (
     ProductTypeItem,
@@ -524,15 +524,35 @@ class ProductsModel:
         if product_ids is not None:
             kwargs["product_ids"] = product_ids
 
-        products = list(ayon_api.get_products(project_name, **kwargs))
-        product_ids = {product["id"] for product in products}
-
         # Add 'status' to fields -> fixed in ayon-python-api 1.0.4
         fields = ayon_api.get_default_fields_for_type("version")
         fields.add("status")
-        versions = ayon_api.get_versions(
-            project_name, product_ids=product_ids, fields=fields
+
+        executor = get_ayon_query_executor()
+        products_future = executor.query(
+            "get_products", project_name, **kwargs
         )
+        versions_future = None
+        if folder_ids is None:
+            # Versions can be queried at the same time as products when
+            #   product ids are known
+            versions_future = executor.query(
+                "get_versions",
+                project_name,
+                product_ids=set(product_ids),
+                fields=fields
+            )
+
+        products = products_future.result()
+        if versions_future is None:
+            product_ids = {product["id"] for product in products}
+            versions_future = executor.query(
+                "get_versions",
+                project_name,
+                product_ids=product_ids,
+                fields=fields
+            )
+        versions = versions_future.result()
 
         return self._create_product_items(
             project_name, products, versions, folder_items=folder_items
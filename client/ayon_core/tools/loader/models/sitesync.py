@@ -1,4 +1,5 @@
 import collections
+import threading
 
 from ayon_api import get_representations, get_versions_links
 
@@ -49,6 +50,8 @@ class SiteSyncModel:
             default_factory=_default_version_availability,
             lifetime=self.status_lifetime
         )
+        # Availability can be requested from UI and from refresh thread
+        self._version_availability_lock = threading.RLock()
         self._repre_status_cache = NestedCacheItem(
             levels=2,
             default_factory=_default_repre_status,
@@ -184,23 +187,48 @@ class SiteSyncModel:
                 for version_id in version_ids
             }
 
-        output = {}
-        project_cache = self._version_availability_cache[project_name]
-        invalid_ids = set()
-        for version_id in version_ids:
-            repre_cache = project_cache[version_id]
-            if repre_cache.is_valid:
-                output[version_id] = repre_cache.get_data()
-            else:
-                invalid_ids.add(version_id)
-
+        output = self.get_cached_version_sync_availability(
+            project_name, version_ids
+        )
+        # Query only versions without valid cache, all of them at once
+        invalid_ids = {
+            version_id
+            for version_id in version_ids
+            if version_id not in output
+        }
         if invalid_ids:
-            self._refresh_version_availability(
-                project_name, invalid_ids
+            output.update(
+                self._refresh_version_availability(project_name, invalid_ids)
             )
-            for version_id in invalid_ids:
+        return output
+
+    def get_cached_version_sync_availability(self, project_name, version_ids):
+        """Sync availability of versions which is cached.
+
+        Does not query server, so it can be used from UI thread.
+
+        Args:
+            project_name (str): Project name.
+            version_ids (Iterable[str]): Version ids.
+
+        Returns:
+            dict[str, tuple[int, int]]: Availability of versions with valid
+                cache.
+        """
+
+        if not self.is_sitesync_enabled(project_name):
+            return {
+                version_id: _default_version_availability()
+                for version_id in version_ids
+            }
+
+        output = {}
+        with self._version_availability_lock:
+            project_cache = self._version_availability_cache[project_name]
+            for version_id in version_ids:
                 version_cache = project_cache[version_id]
-                output[version_id] = version_cache.get_data()
+                if version_cache.is_valid:
+                    output[version_id] = version_cache.get_data()
         return output
 
     def get_representations_sync_status(
@@ -401,21 +429,27 @@ class SiteSyncModel:
         return self._site_icons.get(provider)
 
     def _refresh_version_availability(self, project_name, version_ids):
+        output = {}
         if not project_name or not version_ids:
-            return
-        project_cache = self._version_availability_cache[project_name]
+            return output
 
+        # Server is queried without lock, so UI thread reading cached
+        #   availability is not blocked by the query
         avail_by_id = self._sitesync_addon.get_version_availability(
             project_name,
             version_ids,
             self.get_active_site(project_name),
             self.get_remote_site(project_name),
         )
-        for version_id in version_ids:
-            status = avail_by_id.get(version_id)
-            if status is None:
-                status = _default_version_availability()
-            project_cache[version_id].update_data(status)
+        with self._version_availability_lock:
+            project_cache = self._version_availability_cache[project_name]
+            for version_id in version_ids:
+                status = avail_by_id.get(version_id)
+                if status is None:
+                    status = _default_version_availability()
+                project_cache[version_id].update_data(status)
+                output[version_id] = status
+        return output
 
     def _refresh_representations_sync_status(
         self, project_name, representation_ids
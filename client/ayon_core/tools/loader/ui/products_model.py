@@ -5,6 +5,7 @@ from qtpy import QtGui, QtCore
 
 from ayon_core.style import get_default_entity_icon_color
 from ayon_core.tools.utils import get_qt_icon
+from ayon_core.tools.utils.lib import RefreshThread
 
 PRODUCTS_MODEL_SENDER_NAME = "qt_products_model"
 
@@ -128,6 +129,12 @@ class ProductsModel(QtGui.QStandardItemModel):
         self._last_project_statuses = {}
         self._last_status_icons_by_name = {}
 
+        # Site sync availability is queried in thread
+        self._sync_refresh_thread = None
+        self._sync_refresh_project_name = None
+        self._sync_refresh_version_ids = set()
+        self._sync_pending_version_ids = set()
+
     def get_product_item_indexes(self):
         return [
             item.index()
@@ -367,7 +374,6 @@ class ProductsModel(QtGui.QStandardItemModel):
         model_item.setData(
             version_item.thumbnail_id, VERSION_THUMBNAIL_ID_ROLE)
 
-        # TODO call site sync methods for all versions at once
         project_name = self._last_project_name
         version_id = version_item.version_id
         if repre_count_by_version_id is None:
@@ -378,17 +384,80 @@ class ProductsModel(QtGui.QStandardItemModel):
             )
         if sync_availability_by_version_id is None:
             sync_availability_by_version_id = (
-                self._controller.get_version_sync_availability(
+                self._controller.get_cached_version_sync_availability(
                     project_name, [version_id]
                 )
             )
         repre_count = repre_count_by_version_id[version_id]
-        active, remote = sync_availability_by_version_id[version_id]
+        availability = sync_availability_by_version_id.get(version_id)
+        if availability is None:
+            # Availability is filled when refresh thread finishes
+            availability = (0, 0)
+            self._request_sync_availability([version_id])
+        active, remote = availability
 
         model_item.setData(repre_count, REPRESENTATIONS_COUNT_ROLE)
         model_item.setData(active, SYNC_ACTIVE_SITE_AVAILABILITY)
         model_item.setData(remote, SYNC_REMOTE_SITE_AVAILABILITY)
 
+    def _request_sync_availability(self, version_ids):
+        """Query site sync availability of versions in thread.
+
+        Requests are collected while a query is running and are queried
+            together in next query.
+
+        Args:
+            version_ids (Iterable[str]): Version ids.
+        """
+        self._sync_pending_version_ids |= (
+            set(version_ids) - self._sync_refresh_version_ids
+        )
+        if self._sync_refresh_thread is None:
+            self._start_sync_refresh()
+
+    def _start_sync_refresh(self):
+        project_name = self._last_project_name
+        version_ids = self._sync_pending_version_ids
+        self._sync_pending_version_ids = set()
+        if not project_name or not version_ids:
+            return
+
+        thread = RefreshThread(
+            "sitesync",
+            self._controller.get_version_sync_availability,
+            project_name,
+            version_ids,
+        )
+        thread.refresh_finished.connect(self._on_sync_refresh_finished)
+        self._sync_refresh_thread = thread
+        self._sync_refresh_project_name = project_name
+        self._sync_refresh_version_ids = version_ids
+        thread.start()
+
+    def _on_sync_refresh_finished(self):
+        thread = self._sync_refresh_thread
+        project_name = self._sync_refresh_project_name
+        self._sync_refresh_thread = None
+        self._sync_refresh_project_name = None
+        self._sync_refresh_version_ids = set()
+
+        result = thread.get_result()
+        if result and project_name == self._last_project_name:
+            self._fill_sync_availability(result)
+
+        if self._sync_pending_version_ids:
+            self._start_sync_refresh()
+
+    def _fill_sync_availability(self, sync_availability_by_version_id):
+        for model_item in self._items_by_id.values():
+            version_id = model_item.data(VERSION_ID_ROLE)
+            availability = sync_availability_by_version_id.get(version_id)
+            if availability is None:
+                continue
+            active, remote = availability
+            model_item.setData(active, SYNC_ACTIVE_SITE_AVAILABILITY)
+            model_item.setData(remote, SYNC_REMOTE_SITE_AVAILABILITY)
+
     def _get_product_model_item(
         self,
         product_item,
@@ -438,6 +507,8 @@ class ProductsModel(QtGui.QStandardItemModel):
 
     def refresh(self, project_name, folder_ids):
         self._clear()
+        if project_name != self._last_project_name:
+            self._sync_pending_version_ids = set()
 
         self._last_project_name = project_name
         self._last_folder_ids = folder_ids
@@ -479,11 +550,19 @@ class ProductsModel(QtGui.QStandardItemModel):
         repre_count_by_version_id = self._controller.get_versions_representation_count(
             project_name, version_ids
         )
+        # Availability of all versions is queried at once in thread,
+        #   cached values are used until then
         sync_availability_by_version_id = (
-            self._controller.get_version_sync_availability(
+            self._controller.get_cached_version_sync_availability(
                 project_name, version_ids
             )
         )
+        if self._controller.is_sitesync_enabled(project_name):
+            self._request_sync_availability({
+                version_id
+                for product_item in product_items
+                for version_id in product_item.version_items
+            })
 
         # Prepare product groups
         product_name_matches_by_group = collections.defaultdict(dict)
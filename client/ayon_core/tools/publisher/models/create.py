@@ -489,25 +489,18 @@ class CreateModel:
                 which should be attribute definitions returned.
         """
 
-        # NOTE it would be great if attrdefs would have hash method implemented
-        #   so they could be used as keys in dictionary
         output = []
-        _attr_defs = {}
+        idx_by_attr_def = {}
         for instance in instances:
             for attr_def in instance.creator_attribute_defs:
-                found_idx = None
-                for idx, _attr_def in _attr_defs.items():
-                    if attr_def == _attr_def:
-                        found_idx = idx
-                        break
+                found_idx = idx_by_attr_def.get(attr_def)
 
                 value = None
                 if attr_def.is_value_def:
                     value = instance.creator_attributes[attr_def.key]
                 if found_idx is None:
-                    idx = len(output)
+                    idx_by_attr_def[attr_def] = len(output)
                     output.append((attr_def, [instance], [value]))
-                    _attr_defs[idx] = attr_def
                 else:
                     item = output[found_idx]
                     item[1].append(instance)
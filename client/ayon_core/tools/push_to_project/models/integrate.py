@@ -25,6 +25,7 @@ from ayon_core.settings import get_project_settings
 from ayon_core.pipeline import Anatomy
 from ayon_core.pipeline.version_start import get_versioning_start
 from ayon_core.pipeline.template_data import get_template_data
+from ayon_core.pipeline.load import get_representations_files
 from ayon_core.pipeline.publish import get_publish_template_name
 from ayon_core.pipeline.create import get_product_name
 
@@ -593,10 +594,16 @@ class ProjectPushItemProcess:
 
         anatomy = Anatomy(src_project_name)
 
-        repre_entities = ayon_api.get_representations(
+        repre_entities = list(ayon_api.get_representations(
             src_project_name,
             version_ids={src_version_id}
+        ))
+        # Resolve version resource files stored on version
+        files_by_repre_id = get_representations_files(
+            src_project_name, repre_entities, [version_entity]
         )
+        for repre_entity in repre_entities:
+            repre_entity["files"] = files_by_repre_id[repre_entity["id"]]
         repre_items = [
             ProjectPushRepreItem(repre_entity, anatomy.roots)
             for repre_entity in repre_entities
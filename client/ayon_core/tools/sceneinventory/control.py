@@ -1,11 +1,13 @@
 import ayon_api
 
 from ayon_core.lib.events import QueuedEventSystem
+from ayon_core.lib import register_event_callback
 from ayon_core.host import HostBase
 from ayon_core.pipeline import (
     registered_host,
     get_current_context,
 )
+from ayon_core.pipeline.load import CONTAINERS_CHANGED_TOPIC
 from ayon_core.tools.common_models import HierarchyModel, ProjectsModel
 
 from .models import SiteSyncModel, ContainersModel
@@ -34,6 +36,7 @@ class SceneInventoryController:
         self._hierarchy_model = HierarchyModel(self)
         self._projects_model = ProjectsModel(self)
         self._event_system = self._create_event_system()
+        self._containers_changed_callback = None
 
     def get_host(self) -> HostBase:
         return self._host
@@ -46,6 +49,19 @@ class SceneInventoryController:
     def register_event_callback(self, topic, callback):
         self._event_system.add_callback(topic, callback)
 
+    def start_listening_containers_changes(self):
+        """Listen to changes of containers made by load api in host."""
+        if self._containers_changed_callback is None:
+            self._containers_changed_callback = register_event_callback(
+                CONTAINERS_CHANGED_TOPIC, self._on_containers_changed
+            )
+
+    def stop_listening_containers_changes(self):
+        """Remove callback registered to global event system."""
+        if self._containers_changed_callback is not None:
+            self._containers_changed_callback.deregister()
+            self._containers_changed_callback = None
+
     def reset(self):
         self._current_context = None
         self._current_project = None
@@ -56,6 +72,26 @@ class SceneInventoryController:
         self._sitesync_model.reset()
         self._hierarchy_model.reset()
 
+    def refresh_containers(self):
+        """Refresh containers and keep cached server data.
+
+        Only data of new representations are queried from server.
+        """
+        project_name = self._current_project
+        self._current_context = None
+        self._current_project = None
+        self._current_folder_id = None
+        self._current_folder_set = False
+        # Cached server data are not valid for different project
+        if (
+            project_name is not None
+            and project_name != self.get_current_project_name()
+        ):
+            self.reset()
+            return
+
+        self._containers_model.refresh_containers()
+
     def get_current_context(self):
         if self._current_context is None:
             if hasattr(self._host, "get_current_context"):
@@ -147,5 +183,12 @@ class SceneInventoryController:
             return None
         return folder_item.label
 
+    def _on_containers_changed(self, event):
+        self.emit_event(
+            "containers.changed",
+            {"change_type": event["change_type"]},
+            "controller"
+        )
+
     def _create_event_system(self):
         return QueuedEventSystem()
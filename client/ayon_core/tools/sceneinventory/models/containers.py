@@ -1,3 +1,4 @@
+import time
 import uuid
 import collections
 
@@ -183,22 +184,62 @@ class VersionItem:
         )
 
 
+def _get_container_key(container):
+    """Key of container used to match containers between refreshes."""
+    return (
+        container.get("objectName"),
+        container.get("representation"),
+        container.get("loader"),
+        container.get("namespace"),
+    )
+
+
 class ContainersModel:
+    """Containers in scene with server data of their representations.
+
+    Full reset clears all cached data. Refresh of containers re-reads
+    containers from host and keeps items and server data of unchanged
+    containers, only data of new representations are queried. Versions of
+    products are re-queried when are older than 'version_items_lifetime'
+    so new versions are shown as updates.
+    """
+    version_items_lifetime = 60
+
     def __init__(self, controller):
         self._controller = controller
         self._items_cache = None
         self._containers_by_id = {}
         self._container_items_by_id = {}
+        self._container_item_ids_by_key = {}
+        self._invalid_ids_mapping = {}
         self._version_items_by_product_id = {}
+        self._version_items_time_by_product_id = {}
         self._repre_info_by_id = {}
 
     def reset(self):
         self._items_cache = None
         self._containers_by_id = {}
         self._container_items_by_id = {}
+        self._container_item_ids_by_key = {}
+        self._invalid_ids_mapping = {}
         self._version_items_by_product_id = {}
+        self._version_items_time_by_product_id = {}
         self._repre_info_by_id = {}
 
+    def refresh_containers(self):
+        """Mark containers to be re-read from host on next request.
+
+        Server data of representations and versions are kept.
+        """
+        self._items_cache = None
+        min_time = time.time() - self.version_items_lifetime
+        for product_id, cache_time in tuple(
+            self._version_items_time_by_product_id.items()
+        ):
+            if cache_time < min_time:
+                self._version_items_by_product_id.pop(product_id, None)
+                self._version_items_time_by_product_id.pop(product_id)
+
     def get_containers(self):
         self._update_cache()
         return list(self._containers_by_id.values())
@@ -274,6 +315,17 @@ class ContainersModel:
             repre_info = RepresentationInfo(**kwargs)
             self._repre_info_by_id[repre_id] = repre_info
             output[repre_id] = repre_info
+
+            # Version could be created after versions of product were
+            #   cached, e.g. when container was updated to new version
+            version_items = self._version_items_by_product_id.get(
+                repre_info.product_id
+            )
+            if (
+                version_items is not None
+                and repre_info.version_id not in version_items
+            ):
+                self._version_items_by_product_id.pop(repre_info.product_id)
         return output
 
     def get_version_items(self, product_ids):
@@ -312,6 +364,7 @@ class ContainersModel:
                     version_entity
                 )
 
+            cache_time = time.time()
             for product_id, version_entities in (
                 version_entities_by_product_id.items()
             ):
@@ -337,6 +390,9 @@ class ContainersModel:
                 self._version_items_by_product_id[product_id] = (
                     version_items_by_id
                 )
+                self._version_items_time_by_product_id[product_id] = (
+                    cache_time
+                )
 
         return {
             product_id: dict(self._version_items_by_product_id[product_id])
@@ -355,35 +411,60 @@ class ContainersModel:
         else:
             containers = []
 
+        # Items of unchanged containers are reused so their ids stay same
+        previous_item_ids_by_key = {
+            key: list(item_ids)
+            for key, item_ids in self._container_item_ids_by_key.items()
+        }
+        previous_items_by_id = self._container_items_by_id
+
         container_items = []
         containers_by_id = {}
         container_items_by_id = {}
-        invalid_ids_mapping = {}
+        container_item_ids_by_key = collections.defaultdict(list)
+        invalid_ids_mapping = self._invalid_ids_mapping
         for container in containers:
             try:
-                item = ContainerItem.from_container_data(container)
-                repre_id = item.representation_id
+                key = _get_container_key(container)
+                hash(key)
+            except Exception:
+                key = None
+
+            item = None
+            if key in previous_item_ids_by_key:
+                item_ids = previous_item_ids_by_key[key]
+                if item_ids:
+                    item = previous_items_by_id[item_ids.pop(0)]
+
+            if item is None:
                 try:
-                    uuid.UUID(repre_id)
-                except (ValueError, TypeError, AttributeError):
-                    # Fake not existing representation id so container is shown in UI
-                    #   but as invalid
-                    item.representation_id = invalid_ids_mapping.setdefault(
-                        repre_id, uuid.uuid4().hex
+                    item = ContainerItem.from_container_data(container)
+                    repre_id = item.representation_id
+                    try:
+                        uuid.UUID(repre_id)
+                    except (ValueError, TypeError, AttributeError):
+                        # Fake not existing representation id so container is shown in UI
+                        #   but as invalid
+                        item.representation_id = (
+                            invalid_ids_mapping.setdefault(
+                                repre_id, uuid.uuid4().hex
+                            )
+                        )
+
+                except Exception as e:
+                    # skip item if required data are missing
+                    self._controller.log_error(
+                        f"Failed to create item: {e}"
                     )
-
-            except Exception as e:
-                # skip item if required data are missing
-                self._controller.log_error(
-                    f"Failed to create item: {e}"
-                )
-                continue
+                    continue
 
             containers_by_id[item.item_id] = container
             container_items_by_id[item.item_id] = item
+            if key is not None:
+                container_item_ids_by_key[key].append(item.item_id)
             container_items.append(item)
 
-
         self._containers_by_id = containers_by_id
         self._container_items_by_id = container_items_by_id
+        self._container_item_ids_by_key = dict(container_item_ids_by_key)
         self._items_cache = container_items
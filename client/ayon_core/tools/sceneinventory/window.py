@@ -65,8 +65,15 @@ class SceneInventoryWindow(QtWidgets.QDialog):
         show_timer.setInterval(0)
         show_timer.setSingleShot(False)
 
+        # Containers can change many times in row, e.g. on update of all
+        #   containers, refresh only once after last change
+        changes_timer = QtCore.QTimer()
+        changes_timer.setInterval(200)
+        changes_timer.setSingleShot(True)
+
         # signals
         show_timer.timeout.connect(self._on_show_timer)
+        changes_timer.timeout.connect(self._on_changes_timer)
         text_filter.textChanged.connect(self._on_text_filter_change)
         outdated_only_checkbox.stateChanged.connect(
             self._on_outdated_state_change
@@ -74,11 +81,16 @@ class SceneInventoryWindow(QtWidgets.QDialog):
         view.hierarchy_view_changed.connect(
             self._on_hierarchy_view_change
         )
-        view.data_changed.connect(self._on_refresh_request)
+        view.data_changed.connect(self._on_data_change)
         refresh_button.clicked.connect(self._on_refresh_request)
         update_all_button.clicked.connect(self._on_update_all)
 
+        controller.register_event_callback(
+            "containers.changed", self._on_containers_change
+        )
+
         self._show_timer = show_timer
+        self._changes_timer = changes_timer
         self._show_counter = 0
         self._controller = controller
         self._update_all_button = update_all_button
@@ -89,6 +101,7 @@ class SceneInventoryWindow(QtWidgets.QDialog):
 
     def showEvent(self, event):
         super(SceneInventoryWindow, self).showEvent(event)
+        self._controller.start_listening_containers_changes()
         if self._first_show:
             self._first_show = False
             self.setStyleSheet(style.load_stylesheet())
@@ -96,6 +109,10 @@ class SceneInventoryWindow(QtWidgets.QDialog):
         self._show_counter = 0
         self._show_timer.start()
 
+    def closeEvent(self, event):
+        self._controller.stop_listening_containers_changes()
+        super(SceneInventoryWindow, self).closeEvent(event)
+
     def keyPressEvent(self, event):
         """Custom keyPressEvent.
 
@@ -112,8 +129,28 @@ class SceneInventoryWindow(QtWidgets.QDialog):
 
         self.refresh()
 
-    def refresh(self):
-        self._controller.reset()
+    def _on_data_change(self):
+        self._changes_timer.start()
+
+    def _on_containers_change(self):
+        if self.isVisible():
+            self._changes_timer.start()
+
+    def _on_changes_timer(self):
+        self.refresh(full=False)
+
+    def refresh(self, full=True):
+        """Refresh inventory.
+
+        Args:
+            full (Optional[bool]): Clear all cached data. Otherwise only
+                containers are re-read from host and server data are
+                queried only for new representations.
+        """
+        if full:
+            self._controller.reset()
+        else:
+            self._controller.refresh_containers()
         self._view.refresh()
 
     def _on_show_timer(self):
@@ -121,6 +158,7 @@ class SceneInventoryWindow(QtWidgets.QDialog):
             self._show_counter += 1
             return
         self._show_timer.stop()
+        # Server data may have changed while window was hidden
         self.refresh()
 
     def _on_hierarchy_view_change(self, enabled):
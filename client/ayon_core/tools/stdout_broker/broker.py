@@ -1,5 +1,6 @@
 import os
 import sys
+import zlib
 import threading
 import collections
 import json
@@ -13,13 +14,39 @@ from ayon_core.modules.webserver import HostMsgAction
 log = Logger.get_logger(__name__)
 
 
+class DropPolicy:
+    """What happens with new output when buffer is full."""
+    # Keep latest output, oldest buffered output is dropped
+    OLDEST = "oldest"
+    # Keep buffered output, new output is dropped
+    NEWEST = "newest"
+
+
 class StdOutBroker:
     """
     Application showing console in Services tray for non python hosts
     instead of cmd window.
+
+    Output is stored to bounded buffer and sent to tray from sender thread
+    in batches, so write calls of host never wait for the tray connection.
+    When buffer is full output is dropped based on 'DROP_POLICY' and
+    a summary of dropped output is sent to tray.
     """
+    # Maximum number of write calls kept in buffer
     MAX_LINES = 10000
+    DROP_POLICY = DropPolicy.OLDEST
+    # Send information about count of dropped writes
+    SEND_DROP_SUMMARY = True
+    # Maximum size of text sent in one message
+    MAX_BATCH_SIZE = 256 * 1024
+    # Messages bigger than this size are sent zlib compressed,
+    #   compression is disabled if value is 'None'
+    COMPRESS_MIN_SIZE = 16 * 1024
     TIMER_TIMEOUT = 0.200
+    # Seconds to wait before next connection attempt
+    RECONNECT_TIMEOUT = 5.0
+    # Seconds to wait for sender thread on stop
+    STOP_TIMEOUT = 5.0
 
     def __init__(self, host_name):
         self.host_name = host_name
@@ -27,16 +54,25 @@ class StdOutBroker:
 
         self.original_stdout_write = None
         self.original_stderr_write = None
-        self.log_queue = collections.deque()
+        # 'deque' with 'maxlen' drops oldest items on append
+        self.log_queue = collections.deque(maxlen=self.MAX_LINES)
+        self._queue_lock = threading.Lock()
+        self._control_queue = collections.deque()
+        self._dropped_count = 0
+        # Batches popped from queue which were not sent yet
+        self._pending_batches = collections.deque()
+        self._initialized_sent = False
+        self._last_connect_attempt = None
 
         date_str = datetime.now().strftime("%d%m%Y%H%M%S")
         self.host_id = "{}_{}".format(self.host_name, date_str)
 
         self._std_available = False
         self._is_running = False
+        self._stop_event = threading.Event()
         self._catch_std_outputs()
 
-        self._timer = None
+        self._sender_thread = None
 
     @property
     def send_to_tray(self):
@@ -44,82 +80,113 @@ class StdOutBroker:
         return self.webserver_client and self._std_available
 
     def start(self):
-        """Start app, create and start timer"""
+        """Start app, create and start sender thread"""
         if not self._std_available or self._is_running:
             return
+
+        if not os.environ.get("AYON_WEBSERVER_URL"):
+            print("Unknown webserver url, cannot connect to pass log")
+            return
+
         self._is_running = True
-        self._create_timer()
-        self._connect_to_tray()
+        self._stop_event.clear()
+        thread = threading.Thread(
+            target=self._sender_loop,
+            name="StdOutBrokerSender",
+            daemon=True
+        )
+        thread.start()
+        self._sender_thread = thread
 
     def stop(self):
         """Disconnect from Tray, process last logs"""
         if not self._is_running:
             return
         self._is_running = False
-        self._process_queue()
-        self._disconnect_from_tray()
+        print("Host {} closing".format(self.host_name))
+        self._control_queue.append(
+            self._create_payload(HostMsgAction.CLOSE)
+        )
+        self._stop_event.set()
+        if self._sender_thread is not None:
+            self._sender_thread.join(self.STOP_TIMEOUT)
+            self._sender_thread = None
 
     def host_connected(self):
         """Send to Tray console that host is ready - icon change. """
         log.info("Host {} connected".format(self.host_id))
 
-        payload = {
-            "host": self.host_id,
-            "action": HostMsgAction.INITIALIZED,
-            "text": "Integration with {}".format(
+        self._control_queue.append(
+            self._create_payload(HostMsgAction.INITIALIZED)
+        )
+
+    def _create_payload(self, action, text=None):
+        if text is None:
+            text = "Integration with {}".format(
                 str.capitalize(self.host_name))
+        return {
+            "host": self.host_id,
+            "action": action,
+            "text": text
         }
-        self._send(payload)
-
-    def _create_timer(self):
-        timer = threading.Timer(self.TIMER_TIMEOUT, self._timer_callback)
-        timer.start()
-        self._timer = timer
 
-    def _timer_callback(self):
-        if not self._is_running:
-            return
-        self._process_queue()
-        self._create_timer()
+    def _sender_loop(self):
+        while True:
+            is_stopping = self._stop_event.wait(self.TIMER_TIMEOUT)
+            self._process_queue()
+            if is_stopping:
+                break
+        self._disconnect_from_tray()
 
     def _connect_to_tray(self):
         """Connect to Tray webserver to pass console output. """
         if not self._std_available:  # not content to log
-            return
-        ws = websocket.WebSocket()
-        webserver_url = os.environ.get("AYON_WEBSERVER_URL")
+            return False
 
+        webserver_url = os.environ.get("AYON_WEBSERVER_URL")
         if not webserver_url:
-            print("Unknown webserver url, cannot connect to pass log")
-            return
+            return False
 
         webserver_url = webserver_url.replace("http", "ws")
-        ws.connect("{}/ws/host_listener".format(webserver_url))
+        ws = websocket.WebSocket()
+        try:
+            ws.connect("{}/ws/host_listener".format(webserver_url))
+        except Exception:
+            return False
         self.webserver_client = ws
 
-        payload = {
-            "host": self.host_id,
-            "action": HostMsgAction.CONNECTING,
-            "text": "Integration with {}".format(
-                str.capitalize(self.host_name))
-        }
-        self._send(payload)
+        # Tray may have been restarted, it must know about host before
+        #   receiving any output
+        actions = [HostMsgAction.CONNECTING]
+        if self._initialized_sent:
+            actions.append(HostMsgAction.INITIALIZED)
+        for action in actions:
+            if not self._send(self._create_payload(action)):
+                return False
+        return True
+
+    def _ensure_connection(self):
+        if self.webserver_client is not None:
+            return True
+
+        now = datetime.now().timestamp()
+        if (
+            self._last_connect_attempt is not None
+            and now - self._last_connect_attempt < self.RECONNECT_TIMEOUT
+        ):
+            return False
+        self._last_connect_attempt = now
+        return self._connect_to_tray()
 
     def _disconnect_from_tray(self):
-        """Send to Tray that host is closing - remove from Services. """
-        print("Host {} closing".format(self.host_name))
+        """Close connection to Tray, close message is sent from queue."""
         if not self.webserver_client:
             return
-
-        payload = {
-            "host": self.host_id,
-            "action": HostMsgAction.CLOSE,
-            "text": "Integration with {}".format(
-                str.capitalize(self.host_name))
-        }
-
-        self._send(payload)
-        self.webserver_client.close()
+        try:
+            self.webserver_client.close()
+        except Exception:
+            pass
+        self.webserver_client = None
 
     def _catch_std_outputs(self):
         """Redirects standard out and error to own functions"""
@@ -133,42 +200,119 @@ class StdOutBroker:
             sys.stderr.write = self._my_stderr_write
             self._std_available = True
 
+    def _add_to_queue(self, text):
+        """Store text to buffer.
+
+        Lock is held only for append, text object is stored as is, joining
+        and encoding happens in sender thread.
+        """
+        log_queue = self.log_queue
+        with self._queue_lock:
+            if len(log_queue) == log_queue.maxlen:
+                self._dropped_count += 1
+                if self.DROP_POLICY == DropPolicy.NEWEST:
+                    return
+            log_queue.append(text)
+
     def _my_stdout_write(self, text):
         """Appends outputted text to queue, keep writing to original stdout"""
         if self.original_stdout_write is not None:
             self.original_stdout_write(text)
-        if self.send_to_tray:
-            self.log_queue.append(text)
+        if self._is_running:
+            self._add_to_queue(text)
 
     def _my_stderr_write(self, text):
         """Appends outputted text to queue, keep writing to original stderr"""
         if self.original_stderr_write is not None:
             self.original_stderr_write(text)
-        if self.send_to_tray:
-            self.log_queue.append(text)
+        if self._is_running:
+            self._add_to_queue(text)
+
+    def _pop_batches(self):
+        """Pop buffered text and split it to batches by size."""
+        with self._queue_lock:
+            queued_lines = list(self.log_queue)
+            self.log_queue.clear()
+            dropped_count = self._dropped_count
+            self._dropped_count = 0
+
+        batches = []
+        lines = []
+        size = 0
+        for line in queued_lines:
+            if lines and size + len(line) > self.MAX_BATCH_SIZE:
+                batches.append("\n".join(lines))
+                lines = []
+                size = 0
+            lines.append(line)
+            size += len(line) + 1
+
+        if dropped_count and self.SEND_DROP_SUMMARY:
+            lines.append(
+                "... {} outputs were dropped (buffer is full) ...".format(
+                    dropped_count
+                )
+            )
+
+        if lines:
+            batches.append("\n".join(lines))
+        return batches
 
     def _process_queue(self):
-        """Sends lines and purges queue"""
-        if not self.send_to_tray:
+        """Sends control messages and lines, purges queue"""
+        if (
+            not self._control_queue
+            and not self._pending_batches
+            and not self.log_queue
+        ):
             return
 
-        lines = tuple(self.log_queue)
-        self.log_queue.clear()
-        if lines:
-            payload = {
-                "host": self.host_id,
-                "action": HostMsgAction.ADD,
-                "text": "\n".join(lines)
-            }
+        if not self._ensure_connection():
+            return
 
-            self._send(payload)
+        while self._control_queue:
+            payload = self._control_queue[0]
+            if not self._send(payload):
+                return
+            self._control_queue.popleft()
+            if payload["action"] == HostMsgAction.INITIALIZED:
+                self._initialized_sent = True
+
+        if not self._pending_batches:
+            self._pending_batches.extend(self._pop_batches())
+
+        while self._pending_batches:
+            payload = self._create_payload(
+                HostMsgAction.ADD, self._pending_batches[0]
+            )
+            if not self._send(payload):
+                # Connection is lost, keep batches for next connection to
+                #   not block the sender thread on broken connection
+                break
+            self._pending_batches.popleft()
 
     def _send(self, payload):
-        """Worker method to send to existing websocket connection."""
+        """Worker method to send to existing websocket connection.
+
+        Returns:
+            bool: Payload was sent.
+        """
         if not self.send_to_tray:
-            return
+            return False
 
+        data = json.dumps(payload)
         try:
-            self.webserver_client.send(json.dumps(payload))
-        except ConnectionResetError:  # Tray closed
-            self._connect_to_tray()
+            if (
+                self.COMPRESS_MIN_SIZE is not None
+                and len(data) > self.COMPRESS_MIN_SIZE
+            ):
+                self.webserver_client.send_binary(
+                    zlib.compress(data.encode("utf-8"))
+                )
+            else:
+                self.webserver_client.send(data)
+
+        except Exception:  # Tray closed
+            self._disconnect_from_tray()
+            return False
+        return True
@@ -1,11 +1,13 @@
 import os
 import re
+import hashlib
+from concurrent.futures import ThreadPoolExecutor
 
 import click
 import speedcopy
 import ayon_api
 
-from ayon_core.lib import Terminal
+from ayon_core.lib import Terminal, create_hard_link
 from ayon_core.pipeline import Anatomy
 from ayon_core.pipeline.template_data import get_template_data
 
@@ -17,12 +19,51 @@ texture_extensions = ['.tif', '.tiff', '.jpg', '.jpeg', '.tx', '.png', '.tga',
 
 
 class TextureCopy:
+    """Copy textures to new version of texture product.
+
+    Args:
+        workers (Optional[int]): Number of threads used to scan and
+            copy textures.
+        link_unchanged (Optional[bool]): Hardlink textures with same
+            content as in previous version instead of copying them.
+    """
+    hash_chunk_size = 1024 * 1024
+
+    def __init__(self, workers=None, link_unchanged=True):
+        if not workers:
+            workers = min(32, (os.cpu_count() or 1) + 4)
+        self._workers = workers
+        self._link_unchanged = link_unchanged
+
+    def _scan_dir(self, path):
+        textures = []
+        subdirs = []
+        with os.scandir(path) as entries:
+            for entry in entries:
+                # Symlinked directories are not followed to avoid cycles
+                if entry.is_dir(follow_symlinks=False):
+                    subdirs.append(entry.path)
+                elif entry.is_dir():
+                    continue
+                elif (
+                    os.path.splitext(entry.name)[1].lower()
+                    in texture_extensions
+                ):
+                    textures.append(entry.path)
+        return textures, subdirs
+
     def _get_textures(self, path):
         textures = []
-        for dir, subdir, files in os.walk(path):
-            textures.extend(
-                os.path.join(dir, x) for x in files
-                if os.path.splitext(x)[1].lower() in texture_extensions)
+        with ThreadPoolExecutor(max_workers=self._workers) as executor:
+            futures = [executor.submit(self._scan_dir, path)]
+            while futures:
+                dir_textures, subdirs = futures.pop(0).result()
+                textures.extend(dir_textures)
+                futures.extend(
+                    executor.submit(self._scan_dir, subdir)
+                    for subdir in subdirs
+                )
+        textures.sort()
         return textures
 
     def _get_destination_path(self, folder_entity, project_entity):
@@ -45,29 +86,99 @@ class TextureCopy:
         )
         return template_obj.format_strict(template_data)
 
-    def _get_version(self, path):
-        versions = [0]
-        dirs = [f.path for f in os.scandir(path) if f.is_dir()]
-        for d in dirs:
-            ver = re.search(r'^v(\d+)$',
-                            os.path.basename(d),
-                            flags=re.IGNORECASE)
+    def _get_versions(self, path):
+        versions = {}
+        for entry in os.scandir(path):
+            if not entry.is_dir():
+                continue
+            ver = re.search(r'^v(\d+)$', entry.name, flags=re.IGNORECASE)
             if ver is not None:
-                versions.append(int(ver.group(1)))
+                versions[int(ver.group(1))] = entry.path
+        return versions
 
-        return max(versions) + 1
+    def _get_version(self, path):
+        return max(self._get_versions(path), default=0) + 1
 
-    def _copy_textures(self, textures, destination):
-        for tex in textures:
-            dst = os.path.join(destination,
-                               os.path.basename(tex))
-            t.echo("  - Copy {} -> {}".format(tex, dst))
-            try:
-                speedcopy.copyfile(tex, dst)
-            except Exception as e:
-                t.echo("!!! Copying failed")
-                t.echo("!!! {}".format(e))
-                exit(1)
+    def _get_previous_version_path(self, path):
+        versions = self._get_versions(path)
+        if not versions:
+            return None
+        return versions[max(versions)]
+
+    def _get_file_hash(self, path):
+        file_hash = hashlib.sha256()
+        with open(path, "rb") as stream:
+            for chunk in iter(
+                lambda: stream.read(self.hash_chunk_size), b""
+            ):
+                file_hash.update(chunk)
+        return file_hash.hexdigest()
+
+    def _is_unchanged(self, src, previous):
+        """Source texture has same content as texture in previous version.
+        """
+        if not os.path.isfile(previous):
+            return False
+        if os.path.getsize(src) != os.path.getsize(previous):
+            return False
+        return self._get_file_hash(src) == self._get_file_hash(previous)
+
+    def _copy_texture(self, tex, destination, previous_path):
+        """Copy or hardlink one texture.
+
+        Returns:
+            tuple[bool, int]: Texture was linked and size of texture.
+        """
+        filename = os.path.basename(tex)
+        dst = os.path.join(destination, filename)
+        size = os.path.getsize(tex)
+        if previous_path:
+            previous = os.path.join(previous_path, filename)
+            if self._is_unchanged(tex, previous):
+                try:
+                    create_hard_link(previous, dst)
+                    t.echo("  - Link {} -> {}".format(previous, dst))
+                    return True, size
+                except Exception:
+                    # Different volume or hardlinks not supported
+                    pass
+
+        t.echo("  - Copy {} -> {}".format(tex, dst))
+        speedcopy.copyfile(tex, dst)
+        return False, size
+
+    def _copy_textures(self, textures, destination, previous_path=None):
+        """Copy textures to destination using pool of workers.
+
+        Returns:
+            tuple[int, int]: Bytes copied and bytes linked.
+        """
+        if not self._link_unchanged:
+            previous_path = None
+
+        copied_bytes = 0
+        linked_bytes = 0
+        with ThreadPoolExecutor(max_workers=self._workers) as executor:
+            futures = [
+                executor.submit(
+                    self._copy_texture, tex, destination, previous_path
+                )
+                for tex in textures
+            ]
+            for future in futures:
+                try:
+                    linked, size = future.result()
+                except Exception as e:
+                    t.echo("!!! Copying failed")
+                    t.echo("!!! {}".format(e))
+                    for other_future in futures:
+                        other_future.cancel()
+                    exit(1)
+                if linked:
+                    linked_bytes += size
+                else:
+                    copied_bytes += size
+        return copied_bytes, linked_bytes
 
     def process(self, project_name, folder_path, path):
         """
@@ -109,6 +220,7 @@ class TextureCopy:
                 t.echo("!!! Unable to create destination directory")
                 t.echo("!!! {}".format(e))
                 exit(1)
+        previous_path = self._get_previous_version_path(dst_path)
         version = '%02d' % self._get_version(dst_path)
         t.echo("--- Using version [ {} ]".format(version))
         dst_path = os.path.join(dst_path, "v{}".format(version))
@@ -124,8 +236,12 @@ class TextureCopy:
             exit(1)
 
         t.echo(">>> copying textures  ...")
-        self._copy_textures(textures, dst_path)
-        t.echo(">>> done.")
+        copied_bytes, linked_bytes = self._copy_textures(
+            textures, dst_path, previous_path
+        )
+        t.echo(">>> done. Copied {} bytes, linked {} bytes.".format(
+            copied_bytes, linked_bytes
+        ))
         t.echo("<<< terminating ...")
 
 
@@ -133,12 +249,16 @@ class TextureCopy:
 @click.option('--project', required=True)
 @click.option('--folder', required=True)
 @click.option('--path', required=True)
-def texture_copy(project, folder, path):
+@click.option('--workers', type=int, default=None,
+              help='Number of threads used to scan and copy textures')
+@click.option('--no-link', is_flag=True, default=False,
+              help='Copy all textures, do not hardlink unchanged textures')
+def texture_copy(project, folder, path, workers, no_link):
     t.echo("*** Running Texture tool ***")
     t.echo(">>> Initializing avalon session ...")
     os.environ["AYON_PROJECT_NAME"] = project
     os.environ["AYON_FOLDER_PATH"] = folder
-    TextureCopy().process(project, folder, path)
+    TextureCopy(workers, not no_link).process(project, folder, path)
 
 
 if __name__ == '__main__':
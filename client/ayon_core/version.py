@@ -1,3 +1,3 @@
 # -*- coding: utf-8 -*-
 """Package declaring AYON core addon version."""
-__version__ = "0.4.1-dev.1"
+__version__ = "0.4.1-dev.2"
@@ -59,6 +59,18 @@ class CollectFramesFixDefModel(BaseSettingsModel):
     )
     
 
+class CollectExtractionOffloadModel(BaseSettingsModel):
+    _isGroup = True
+    enabled: bool = SettingsField(
+        False,
+        title="Enabled",
+        description=(
+            "Hand over supported extraction commands to extraction jobs"
+            " service in AYON tray. Integration waits for the jobs."
+        )
+    )
+
+
 class ContributionLayersModel(BaseSettingsModel):
     _layout = "compact"
     name: str = SettingsField(title="Name")
@@ -741,6 +753,17 @@ class IntegrateANTemplateNameProfileModel(BaseSettingsModel):
     template_name: str = SettingsField("", title="Template name")
 
 
+class IntegrateAssetModel(BaseSettingsModel):
+    store_resources_on_version: bool = SettingsField(
+        False,
+        title="Store resource files on version",
+        description=(
+            "Store resource files (e.g. textures of a look) once on version"
+            " data instead of adding them to files of each representation."
+        )
+    )
+
+
 class IntegrateHeroTemplateNameProfileModel(BaseSettingsModel):
     product_types: list[str] = SettingsField(
         default_factory=list,
@@ -817,6 +840,10 @@ class PublishPuginsModel(BaseSettingsModel):
         default_factory=CollectFramesFixDefModel,
         title="Collect Frames to Fix",
     )
+    CollectExtractionOffload: CollectExtractionOffloadModel = SettingsField(
+        default_factory=CollectExtractionOffloadModel,
+        title="Collect Extraction Offload",
+    )
     CollectUSDLayerContributions: CollectUSDLayerContributionsModel = SettingsField(
         default_factory=CollectUSDLayerContributionsModel,
         title="Collect USD Layer Contributions",
@@ -865,6 +892,10 @@ class PublishPuginsModel(BaseSettingsModel):
         default_factory=IntegrateProductGroupModel,
         title="Integrate Product Group"
     )
+    IntegrateAsset: IntegrateAssetModel = SettingsField(
+        default_factory=IntegrateAssetModel,
+        title="Integrate Asset"
+    )
     IntegrateHeroVersion: IntegrateHeroVersionModel = SettingsField(
         default_factory=IntegrateHeroVersionModel,
         title="Integrate Hero Version"
@@ -913,6 +944,9 @@ DEFAULT_PUBLISH_VALUES = {
         "enabled": True,
         "rewrite_version_enable": True
     },
+    "CollectExtractionOffload": {
+        "enabled": False
+    },
     "CollectUSDLayerContributions": {
         "enabled": True,
         "contribution_layers": [
@@ -1176,6 +1210,9 @@ DEFAULT_PUBLISH_VALUES = {
             }
         ]
     },
+    "IntegrateAsset": {
+        "store_resources_on_version": False
+    },
     "IntegrateHeroVersion": {
         "enabled": True,
         "optional": True,
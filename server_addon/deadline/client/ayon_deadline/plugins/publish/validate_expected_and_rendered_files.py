@@ -4,6 +4,7 @@ import requests
 import pyblish.api
 
 from ayon_core.lib import collect_frames
+from ayon_core.pipeline.publish import get_publish_directory_scanner
 from ayon_deadline.abstract_submit_deadline import requests_get
 
 
@@ -34,11 +35,19 @@ class ValidateExpectedFiles(pyblish.api.InstancePlugin):
         frame_list = self._get_dependent_jobs_frames(
             instance, dependent_job_ids)
 
+        # Representations (AOVs) may share staging directory, scan all of
+        #   them at once
+        scanner = get_publish_directory_scanner(instance.context)
+        scanner.prefetch(
+            repre["stagingDir"]
+            for repre in instance.data["representations"]
+        )
+
         for repre in instance.data["representations"]:
             expected_files = self._get_expected_files(repre)
 
             staging_dir = repre["stagingDir"]
-            existing_files = self._get_existing_files(staging_dir)
+            existing_files = scanner.get_filenames(staging_dir)
 
             if self.allow_user_override:
                 # We always check for user override because the user might have
@@ -225,13 +234,6 @@ class ValidateExpectedFiles(pyblish.api.InstancePlugin):
             return json_content.pop()
         return {}
 
-    def _get_existing_files(self, staging_dir):
-        """Returns set of existing file names from 'staging_dir'"""
-        existing_files = set()
-        for file_name in os.listdir(staging_dir):
-            existing_files.add(file_name)
-        return existing_files
-
     def _get_expected_files(self, repre):
         """Returns set of file names in representation['files']
 
@@ -1,83 +1,39 @@
-from collections import deque
-
 import pyblish.api
 from ayon_core.pipeline import registered_host
+from ayon_core.pipeline.publish import NodeGraphAdapter, get_input_tracer
 from ayon_houdini.api import plugin
 
 
-def get_container_members(container):
-    node = container["node"]
-    # Usually the loaded containers don't have any complex references
-    # and the contained children should be all we need. So we disregard
-    # checking for .references() on the nodes.
-    members = set(node.allSubChildren())
-    members.add(node)  # include the node itself
-    return members
-
-
-def collect_input_containers(containers, nodes):
-    """Collect containers that contain any of the node in `nodes`.
-
-    This will return any loaded Avalon container that contains at least one of
-    the nodes. As such, the Avalon container is an input for it. Or in short,
-    there are member nodes of that container.
-
-    Returns:
-        list: Loaded containers that contain the `nodes`
-
-    """
-    # Assume the containers have collected their cached '_members' data
-    # in the collector.
-    return [container for container in containers
-            if any(node in container["_members"] for node in nodes)]
-
-
-def iter_upstream(node):
-    """Yields all upstream inputs for the current node.
-
-    This includes all `node.inputAncestors()` but also traverses through all
-    `node.references()` for the node itself and for any of the upstream nodes.
-    This method has no max-depth and will collect all upstream inputs.
-
-    Yields:
-        hou.Node: The upstream nodes, including references.
+class HoudiniNodeGraphAdapter(NodeGraphAdapter):
+    """Houdini node graph used to trace inputs of instances.
 
+    Upstream of a node are all its input ancestors and references. Upstream
+    of referenced nodes is traversed too.
     """
 
-    upstream = node.inputAncestors(
-        include_ref_inputs=True, follow_subnets=True
-    )
-
-    # Initialize process queue with the node's ancestors itself
-    queue = deque(upstream)
-    collected = set(upstream)
-
-    # Traverse upstream references for all nodes and yield them as we
-    # process the queue.
-    while queue:
-        upstream_node = queue.pop()
-        yield upstream_node
-
-        # Find its references that are not collected yet.
-        references = upstream_node.references()
-        references = [n for n in references if n not in collected]
-
-        queue.extend(references)
-        collected.update(references)
+    def get_containers(self):
+        # For large scenes the querying of "host.ls()" can be relatively slow
+        # e.g. up to a second, the tracer is shared by all instances so
+        # it's triggered only once.
+        host = registered_host()
+        return list(host.ls())
 
-        # Include the references' ancestors that have not been collected yet.
-        for reference in references:
-            if reference in collected:
-                # Might have been collected in previous iteration
-                continue
+    def get_container_members(self, container):
+        node = container["node"]
+        # Usually the loaded containers don't have any complex references
+        # and the contained children should be all we need. So we disregard
+        # checking for .references() on the nodes.
+        members = set(node.allSubChildren())
+        members.add(node)  # include the node itself
+        return members
 
-            ancestors = reference.inputAncestors(
-                include_ref_inputs=True, follow_subnets=True
-            )
-            ancestors = [n for n in ancestors if n not in collected]
+    def get_ancestors(self, node):
+        return node.inputAncestors(
+            include_ref_inputs=True, follow_subnets=True
+        )
 
-            queue.extend(ancestors)
-            collected.update(ancestors)
+    def get_references(self, node):
+        return node.references()
 
 
 class CollectUpstreamInputs(plugin.HoudiniInstancePlugin):
@@ -106,32 +62,11 @@ class CollectUpstreamInputs(plugin.HoudiniInstancePlugin):
             )
             return
 
-        # For large scenes the querying of "host.ls()" can be relatively slow
-        # e.g. up to a second. Many instances calling it easily slows this
-        # down. As such, we cache it so we trigger it only once.
-        # todo: Instead of hidden cache make "CollectContainers" plug-in
-        cache_key = "__cache_containers"
-        scene_containers = instance.context.data.get(cache_key, None)
-        if scene_containers is None:
-            # Query the scenes' containers if there's no cache yet
-            host = registered_host()
-            scene_containers = list(host.ls())
-            for container in scene_containers:
-                # Embed the members into the container dictionary
-                container_members = set(get_container_members(container))
-                container["_members"] = container_members
-            instance.context.data[cache_key] = scene_containers
-
-        inputs = []
-        if scene_containers:
-            # Collect all upstream parents
-            nodes = list(iter_upstream(output))
-            nodes.append(output)
-
-            # Collect containers for the given set of nodes
-            containers = collect_input_containers(scene_containers, nodes)
-
-            inputs = [c["representation"] for c in containers]
+        tracer = get_input_tracer(instance.context, HoudiniNodeGraphAdapter)
+        inputs = [
+            container["representation"]
+            for container in tracer.get_input_containers(output)
+        ]
 
         instance.data["inputRepresentations"] = inputs
         self.log.debug("Collected inputs: %s" % inputs)
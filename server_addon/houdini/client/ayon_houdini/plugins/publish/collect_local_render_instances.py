@@ -1,7 +1,7 @@
 import os
 import pyblish.api
 from ayon_core.pipeline.create import get_product_name
-from ayon_core.pipeline.farm.patterning import match_aov_pattern
+from ayon_core.pipeline.farm.patterning import get_aov_pattern_matcher
 from ayon_core.pipeline.publish import (
     get_plugin_settings,
     apply_plugin_settings_automatically
@@ -74,6 +74,7 @@ class CollectLocalRenderInstances(plugin.HoudiniInstancePlugin):
             instance.data["productName"]
         )
 
+        aov_matcher = get_aov_pattern_matcher("houdini", self.aov_filter)
         for aov_name, aov_filepaths in expectedFiles.items():
             product_name = product_group
 
@@ -95,9 +96,7 @@ class CollectLocalRenderInstances(plugin.HoudiniInstancePlugin):
                 preview = True
             else:
                 # Add Preview tag if the AOV matches the filter.
-                preview = match_aov_pattern(
-                    "houdini", self.aov_filter, aov_filenames[0]
-                )
+                preview = aov_matcher.match(aov_filenames[0])
 
             preview = preview and instance.data.get("review", False)
 
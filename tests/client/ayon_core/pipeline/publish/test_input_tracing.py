@@ -0,0 +1,156 @@
+"""Tests of 'InputTracer' with fake node graph.
+
+Module is loaded directly from file, so tests don't need host, server
+connection or dependencies of 'ayon_core.pipeline'.
+"""
+import os
+import importlib.util
+
+import pytest
+
+CLIENT_ROOT = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)),
+    "..", "..", "..", "..", "..", "client"
+)
+MODULE_PATH = os.path.join(
+    CLIENT_ROOT, "ayon_core", "pipeline", "publish", "input_tracing.py"
+)
+
+
+def _load_input_tracing():
+    spec = importlib.util.spec_from_file_location(
+        "input_tracing", MODULE_PATH
+    )
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+input_tracing = _load_input_tracing()
+
+
+class FakeGraphAdapter(input_tracing.NodeGraphAdapter):
+    """Node graph defined by dictionaries which counts queries.
+
+    Ancestors are resolved recursively from input connections as hosts do.
+    """
+    def __init__(self, inputs, references, members_by_container):
+        self._inputs = inputs
+        self._references = references
+        self._members_by_container = members_by_container
+        self.calls = {
+            "get_containers": 0,
+            "get_ancestors": [],
+            "get_references": [],
+        }
+
+    def get_containers(self):
+        self.calls["get_containers"] += 1
+        return [
+            {"objectName": name, "representation": name + "_repre"}
+            for name in self._members_by_container
+        ]
+
+    def get_container_members(self, container):
+        return self._members_by_container[container["objectName"]]
+
+    def get_ancestors(self, node):
+        self.calls["get_ancestors"].append(node)
+        ancestors = []
+        queue = list(self._inputs.get(node, []))
+        while queue:
+            item = queue.pop(0)
+            if item in ancestors:
+                continue
+            ancestors.append(item)
+            queue.extend(self._inputs.get(item, []))
+        return ancestors
+
+    def get_references(self, node):
+        self.calls["get_references"].append(node)
+        return self._references.get(node, [])
+
+
+@pytest.fixture
+def adapter():
+    # out -> merge -> (cache_a, xform)
+    # xform references 'ctrl' by expression
+    # ctrl -> rig_b
+    inputs = {
+        "out": ["merge"],
+        "merge": ["cache_a", "xform"],
+        "ctrl": ["rig_b"],
+        "other_out": ["cache_a"],
+    }
+    references = {
+        "xform": ["ctrl"],
+    }
+    members_by_container = {
+        "containerA": ["cache_a"],
+        "containerB": ["rig_b"],
+        "containerC": ["unused"],
+    }
+    return FakeGraphAdapter(inputs, references, members_by_container)
+
+
+def _container_names(containers):
+    return [container["objectName"] for container in containers]
+
+
+def test_ancestor_container(adapter):
+    tracer = input_tracing.InputTracer(adapter)
+    containers = tracer.get_input_containers("other_out")
+    assert _container_names(containers) == ["containerA"]
+
+
+def test_reference_ancestor_container(adapter):
+    """Container member is ancestor of node referenced by an ancestor."""
+    tracer = input_tracing.InputTracer(adapter)
+    containers = tracer.get_input_containers("out")
+    assert _container_names(containers) == ["containerA", "containerB"]
+    assert "ctrl" in tracer.get_upstream("out")
+    assert "rig_b" in tracer.get_upstream("out")
+
+    # Ancestors of ancestors are already resolved by adapter
+    assert adapter.calls["get_ancestors"] == ["out", "ctrl"]
+
+
+def test_multiple_nodes_keep_scene_order(adapter):
+    tracer = input_tracing.InputTracer(adapter)
+    containers = tracer.get_input_containers(["ctrl", "other_out"])
+    assert _container_names(containers) == ["containerA", "containerB"]
+
+
+def test_queries_are_cached(adapter):
+    tracer = input_tracing.InputTracer(adapter)
+    tracer.get_input_containers("out")
+    ancestor_calls = list(adapter.calls["get_ancestors"])
+    reference_calls = list(adapter.calls["get_references"])
+
+    tracer.get_input_containers("out")
+    assert adapter.calls["get_ancestors"] == ancestor_calls
+    assert adapter.calls["get_references"] == reference_calls
+
+    # Only ancestors of new traced node are queried
+    tracer.get_input_containers(["out", "merge"])
+    assert adapter.calls["get_ancestors"] == ancestor_calls + ["merge"]
+    assert adapter.calls["get_references"] == reference_calls
+    assert adapter.calls["get_containers"] == 1
+
+
+def test_get_input_tracer_is_shared_by_context():
+    class FakeContext:
+        def __init__(self):
+            self.data = {}
+
+    class EmptyAdapter(input_tracing.NodeGraphAdapter):
+        def get_containers(self):
+            return []
+
+        def get_ancestors(self, node):
+            return []
+
+    context = FakeContext()
+    tracer = input_tracing.get_input_tracer(context, EmptyAdapter)
+    assert input_tracing.get_input_tracer(context, EmptyAdapter) is tracer
+    assert tracer.get_input_containers("node") == []